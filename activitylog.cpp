@@ -0,0 +1,109 @@
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include "activitylog.h"
+#include "commandtable.h"
+#include "user_roles.h"
+
+uint32_t ActivityLog::push(const LogRecord& rec) {
+  records_[nextSeq_ % LOG_CAPACITY] = rec;
+  if (count_ < LOG_CAPACITY) {
+    count_++;
+  }
+  return nextSeq_++;
+}
+
+const LogRecord* ActivityLog::get(uint32_t seq) const {
+  if (seq < firstSeq() || seq >= nextSeq_) {
+    return nullptr;
+  }
+  return &records_[seq % LOG_CAPACITY];
+}
+
+uint8_t userIdFor(const char* username) {
+  for (int i = 0; i < NUM_USERS; i++) {
+    if (users[i].username == username) {
+      return (uint8_t)i;
+    }
+  }
+  return LOG_USER_UNKNOWN;
+}
+
+// Named colors read back from the LED command table, e.g. "RED"
+static bool colorName(uint8_t r, uint8_t g, uint8_t b, char* out, size_t len) {
+  for (const TableEntry& e : LED_COMMAND_TABLE) {
+    if (e.id == LED_CMD_COLOR && e.r == r && e.g == g && e.b == b) {
+      size_t n = e.len < len - 1 ? e.len : len - 1;
+      for (size_t i = 0; i < n; i++) {
+        out[i] = toupper(e.name[i]);
+      }
+      out[n] = '\0';
+      return true;
+    }
+  }
+  return false;
+}
+
+static const char* effectName(uint8_t type) {
+  for (const TableEntry& e : EFFECT_TABLE) {
+    if (e.id == type) {
+      return e.name;
+    }
+  }
+  return "?";
+}
+
+static void formatAction(const LogRecord& rec, char* buf, size_t len) {
+  const LogArgs& a = rec.args;
+  char name[12];
+  switch (rec.action) {
+    case LOG_LOGIN:
+      snprintf(buf, len, "Logged in as %s", getRoleName((UserRole)a.extra));
+      break;
+    case LOG_LOGOUT:
+      snprintf(buf, len, "Logged out");
+      break;
+    case LOG_LED_ON:
+      snprintf(buf, len, "LED turned ON");
+      break;
+    case LOG_LED_OFF:
+      snprintf(buf, len, "LED turned OFF");
+      break;
+    case LOG_LED_COLOR:
+      if (colorName(a.r, a.g, a.b, name, sizeof(name))) {
+        snprintf(buf, len, "LED set to %s", name);
+      } else {
+        snprintf(buf, len, "LED set to #%02X%02X%02X", a.r, a.g, a.b);
+      }
+      break;
+    case LOG_LED_RANGE:
+      snprintf(buf, len, "Pixels %u-%u set to #%02X%02X%02X", a.start, a.start + a.count - 1, a.r, a.g, a.b);
+      break;
+    case LOG_LED_EFFECT:
+      snprintf(buf, len, "Effect %s on pixels %u-%u", effectName(a.extra), a.start, a.start + a.count - 1);
+      break;
+    case LOG_BUZZER_ON:
+      snprintf(buf, len, "Buzzer turned ON");
+      break;
+    case LOG_BUZZER_OFF:
+      snprintf(buf, len, "Buzzer turned OFF");
+      break;
+    case LOG_BUZZER_BEEP:
+      snprintf(buf, len, "Buzzer beeped");
+      break;
+    case LOG_LED_BRIGHTNESS:
+      snprintf(buf, len, "Brightness set to %u", a.extra);
+      break;
+    default:
+      snprintf(buf, len, "Unknown action %u", rec.action);
+      break;
+  }
+}
+
+int formatLogJson(const LogRecord& rec, uint32_t seq, char* buf, size_t len) {
+  char action[48];
+  formatAction(rec, action, sizeof(action));
+  const char* username = rec.user < NUM_USERS ? users[rec.user].username.c_str() : "?";
+  return snprintf(buf, len, "{\"seq\":%lu,\"timestamp\":\"%lus\",\"username\":\"%s\",\"action\":\"%s\"}",
+                  (unsigned long)seq, (unsigned long)rec.timestamp, username, action);
+}
@@ -0,0 +1,64 @@
+#ifndef ACTIVITYLOG_H
+#define ACTIVITYLOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+
+// Activity log kept as fixed-size binary records in a ring buffer.
+// Entries are numbered with a sequence that never repeats, so clients can
+// ask for "everything after seq N" and usually get nothing back. The text
+// shown on the dashboard is only produced when an entry is sent out.
+
+enum LogAction : uint8_t {
+  LOG_LOGIN,        // extra = role
+  LOG_LOGOUT,
+  LOG_LED_ON,
+  LOG_LED_OFF,
+  LOG_LED_COLOR,    // r, g, b
+  LOG_LED_RANGE,    // r, g, b, start, count
+  LOG_LED_EFFECT,   // r, g, b, start, count, extra = effect type
+  LOG_BUZZER_ON,
+  LOG_BUZZER_OFF,
+  LOG_BUZZER_BEEP,
+  LOG_LED_BRIGHTNESS  // extra = brightness
+};
+
+const uint8_t LOG_USER_UNKNOWN = 0xFF;
+
+struct LogArgs {
+  uint8_t r, g, b;
+  uint8_t extra;
+  uint16_t start, count;
+};
+
+struct LogRecord {
+  uint32_t timestamp;  // seconds since boot
+  uint8_t user;        // index into users[]
+  uint8_t action;      // LogAction
+  LogArgs args;
+};
+
+class ActivityLog {
+ public:
+  ActivityLog() : nextSeq_(1), count_(0) {}
+
+  // Returns the sequence number given to the new record
+  uint32_t push(const LogRecord& rec);
+
+  // Sequence of the oldest record still held, and of the next one to come
+  uint32_t firstSeq() const { return nextSeq_ - count_; }
+  uint32_t nextSeq() const { return nextSeq_; }
+  const LogRecord* get(uint32_t seq) const;
+
+ private:
+  LogRecord records_[LOG_CAPACITY];
+  uint32_t nextSeq_;
+  uint32_t count_;
+};
+
+uint8_t userIdFor(const char* username);
+// {"seq":..,"timestamp":"..s","username":"..","action":".."}
+int formatLogJson(const LogRecord& rec, uint32_t seq, char* buf, size_t len);
+
+#endif // ACTIVITYLOG_H
@@ -0,0 +1,22 @@
+#ifndef BENCHTIME_H
+#define BENCHTIME_H
+
+#include <chrono>
+#include <cstdint>
+
+// Timing loop shared by the host benchmarks: the average time of one fn()
+// call over `runs` calls, in ns. Results written to sink keep the work
+// from being optimized away.
+template <typename Fn>
+double nsPerRun(int runs, Fn fn) {
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; i++) {
+    fn();
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(t1 - t0).count() / runs;
+}
+
+static volatile uint32_t sink;
+
+#endif // BENCHTIME_H
@@ -0,0 +1,271 @@
+// Web UI load benchmark on the host build (env:native_http): replays
+// browser traffic against the routes from setupWebServer() through the
+// real HttpServer and reports, per route, throughput, latency, bytes sent
+// and heap use.
+//
+//   pio run -e native_http && .pio/build/native_http/program [tabs] [seconds]
+//
+// Each tab logs in, loads the dashboard and its session data, then polls
+// /status once per (simulated) second and /logs?since= every LOGS_EVERY
+// seconds, and logs out at the end. The simulated seconds run back to back.
+// Tabs keep their own keep-alive connection, as browsers do;
+// HTTP_MAX_CONNECTIONS limits how many get one. Heap figures cover
+// everything allocated while the server handles a request, String
+// temporaries included.
+
+#include <Arduino.h>
+#include <WiFiServer.h>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+#include "../ledserver.h"
+#include "../mqttlink.h"
+#include "hostalloc.h"
+
+void setup();
+void loop();
+
+static const int DEFAULT_TABS = 3;
+static const int DEFAULT_SECONDS = 300;
+static const int LOGS_EVERY = 5;
+static const uint32_t RESPONSE_TIMEOUT_MS = 2000;
+
+static const char* const ACCOUNTS[][2] = {
+  {"admin", "admin123"},
+  {"moderator", "mod123"},
+  {"viewer", "view123"},
+};
+
+struct RouteStats {
+  std::vector<double> latencyUs;
+  uint64_t bytes = 0;
+  uint64_t allocations = 0;
+  uint64_t allocatedBytes = 0;
+  int64_t peakBytes = 0;
+  uint32_t failures = 0;
+};
+
+static std::map<std::string, RouteStats> routes;
+
+// Fixed buffer so reading the reply allocates nothing inside the window
+static char response[256 * 1024];
+
+struct Response {
+  int status;
+  size_t length;       // header + body bytes received
+  const char* cookie;  // session token in Set-Cookie, points into response
+  size_t cookieLength;
+  const char* body;
+  bool closing;        // server sent Connection: close
+};
+
+static const char* findHeader(const char* head, const char* end, const char* name) {
+  size_t n = strlen(name);
+  for (const char* p = head; p < end; p++) {
+    if ((p == head || p[-1] == '\n') && strncasecmp(p, name, n) == 0 && p[n] == ':') {
+      p += n + 1;
+      while (*p == ' ') {
+        p++;
+      }
+      return p;
+    }
+  }
+  return nullptr;
+}
+
+// True once the reply in response[0..len) is complete
+static bool responseComplete(size_t len, bool closed) {
+  response[len] = '\0';
+  const char* headEnd = strstr(response, "\r\n\r\n");
+  if (headEnd == nullptr) {
+    return false;
+  }
+  const char* body = headEnd + 4;
+  size_t bodyLen = response + len - body;
+  const char* contentLength = findHeader(response, headEnd, "Content-Length");
+  if (contentLength != nullptr) {
+    return bodyLen >= strtoul(contentLength, nullptr, 10);
+  }
+  const char* encoding = findHeader(response, headEnd, "Transfer-Encoding");
+  if (encoding != nullptr && strncasecmp(encoding, "chunked", 7) == 0) {
+    return len >= 5 && memcmp(response + len - 5, "0\r\n\r\n", 5) == 0;
+  }
+  return closed;
+}
+
+// Sends one request on fd and runs the server until the reply is in
+static bool exchange(int fd, const char* request, Response& r) {
+  if (::send(fd, request, strlen(request), MSG_NOSIGNAL) < 0) {
+    return false;
+  }
+  size_t len = 0;
+  bool closed = false;
+  uint32_t start = millis();
+  while (!responseComplete(len, closed)) {
+    if (closed || millis() - start > RESPONSE_TIMEOUT_MS) {
+      return false;
+    }
+    server.handleClient();
+    ssize_t n = ::recv(fd, response + len, sizeof(response) - 1 - len, MSG_DONTWAIT);
+    if (n > 0) {
+      len += n;
+    } else if (n == 0) {
+      closed = true;
+    }
+  }
+  r.status = atoi(response + 9);
+  r.length = len;
+  r.body = strstr(response, "\r\n\r\n") + 4;
+  const char* connection = findHeader(response, r.body, "Connection");
+  r.closing = closed || (connection != nullptr && strncasecmp(connection, "close", 5) == 0);
+  r.cookie = findHeader(response, r.body, "Set-Cookie");
+  r.cookieLength = 0;
+  if (r.cookie != nullptr && strncmp(r.cookie, "session=", 8) == 0) {
+    r.cookie += 8;
+    r.cookieLength = strcspn(r.cookie, ";\r");
+  }
+  return true;
+}
+
+static bool timedExchange(const char* route, int fd, const char* request, Response& r) {
+  hostAllocReset();
+  auto t0 = std::chrono::steady_clock::now();
+  bool ok = exchange(fd, request, r);
+  auto t1 = std::chrono::steady_clock::now();
+  HostAllocStats heap = hostAllocStats();
+
+  RouteStats& s = routes[route];
+  s.latencyUs.push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+  s.allocations += heap.allocations;
+  s.allocatedBytes += heap.bytes;
+  s.peakBytes = std::max(s.peakBytes, heap.peakBytes);
+  if (!ok || r.status >= 400) {
+    s.failures++;
+  }
+  if (ok) {
+    s.bytes += r.length;
+  }
+  return ok;
+}
+
+struct Tab {
+  int fd;
+  std::string cookie;
+  uint32_t logsSince;
+  char request[512];
+};
+
+// Like a browser, reconnects once the server has closed the connection
+static bool send(Tab& tab, const char* route, Response& r) {
+  if (tab.fd < 0) {
+    tab.fd = WiFiServer::hostConnect(80);
+  }
+  bool ok = timedExchange(route, tab.fd, tab.request, r);
+  if (!ok || r.closing) {
+    ::close(tab.fd);
+    tab.fd = -1;
+  }
+  return ok;
+}
+
+static bool get(Tab& tab, const char* route, const char* path, Response& r) {
+  snprintf(tab.request, sizeof(tab.request),
+           "GET %s HTTP/1.1\r\nHost: device\r\nCookie: session=%s\r\nAccept-Encoding: gzip\r\n\r\n", path,
+           tab.cookie.c_str());
+  return send(tab, route, r);
+}
+
+static void login(Tab& tab, int index) {
+  const char* const* account = ACCOUNTS[index % (sizeof(ACCOUNTS) / sizeof(ACCOUNTS[0]))];
+  char form[96];
+  int n = snprintf(form, sizeof(form), "username=%s&password=%s", account[0], account[1]);
+  snprintf(tab.request, sizeof(tab.request),
+           "POST /login HTTP/1.1\r\nHost: device\r\nContent-Type: application/x-www-form-urlencoded\r\n"
+           "Content-Length: %d\r\n\r\n%s",
+           n, form);
+  Response r;
+  if (send(tab, "POST /login", r) && r.cookie != nullptr) {
+    tab.cookie.assign(r.cookie, r.cookieLength);
+  }
+}
+
+static void pollLogs(Tab& tab) {
+  char path[48];
+  snprintf(path, sizeof(path), "/logs?since=%u", (unsigned)tab.logsSince);
+  Response r;
+  if (!get(tab, "GET /logs", path, r)) {
+    return;
+  }
+  const char* next = strstr(r.body, "\"next\":");
+  if (next != nullptr) {
+    tab.logsSince = strtoul(next + 7, nullptr, 10);
+  }
+}
+
+int main(int argc, char** argv) {
+  int tabCount = argc > 1 ? atoi(argv[1]) : DEFAULT_TABS;
+  int seconds = argc > 2 ? atoi(argv[2]) : DEFAULT_SECONDS;
+
+  Serial.quiet = true;
+  setup();
+  // The web server starts once WiFi is up, from loop(); the MQTT link may
+  // be up before the WiFi timer has noticed
+  uint32_t start = millis();
+  while ((!mqttLink.up() || !WiFiServer::hostListening(80)) && millis() - start < 10000) {
+    loop();
+    delay(1);
+  }
+
+  std::vector<Tab> tabs(tabCount);
+  auto t0 = std::chrono::steady_clock::now();
+  Response r;
+  for (int i = 0; i < tabCount; i++) {
+    Tab& tab = tabs[i];
+    tab.fd = -1;
+    tab.logsSince = 0;
+    login(tab, i);
+    get(tab, "GET /dashboard", "/dashboard", r);
+    get(tab, "GET /api/session", "/api/session", r);
+    pollLogs(tab);
+  }
+  for (int second = 0; second < seconds; second++) {
+    for (Tab& tab : tabs) {
+      get(tab, "GET /status", "/status", r);
+      if (second % LOGS_EVERY == 0) {
+        pollLogs(tab);
+      }
+    }
+  }
+  for (Tab& tab : tabs) {
+    get(tab, "GET /logout", "/logout", r);
+    if (tab.fd >= 0) {
+      ::close(tab.fd);
+    }
+  }
+  double wallS = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+  printf("%d tabs, %d simulated seconds%s\n\n", tabCount, seconds,
+         hostAllocSupported() ? "" : " (no allocation counts on this libc)");
+  printf("%-17s %6s %5s %9s %8s %8s %9s %10s %10s %8s\n", "route", "reqs", "fail", "req/s", "p50 us", "p99 us",
+         "bytes/req", "allocs/req", "heap B/req", "peak B");
+  size_t total = 0;
+  for (auto& entry : routes) {
+    RouteStats& s = entry.second;
+    std::vector<double>& l = s.latencyUs;
+    std::sort(l.begin(), l.end());
+    size_t n = l.size();
+    double sumUs = 0;
+    for (double us : l) {
+      sumUs += us;
+    }
+    total += n;
+    printf("%-17s %6zu %5u %9.0f %8.1f %8.1f %9.0f %10.2f %10.0f %8lld\n", entry.first.c_str(), n, s.failures,
+           n / (sumUs / 1e6), l[n / 2], l[n * 99 / 100], (double)s.bytes / n, (double)s.allocations / n,
+           (double)s.allocatedBytes / n, (long long)s.peakBytes);
+  }
+  printf("\n%zu requests in %.2f s, %.0f req/s\n", total, wallS, total / wallS);
+  fflush(stdout);
+  return 0;
+}
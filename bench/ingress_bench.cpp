@@ -0,0 +1,149 @@
+// MQTT ingress benchmark on the host build (env:native): replays recorded
+// command mixes through mqttCallback() -> handleLEDControl() -> setLED()
+// and reports commands/sec, latency percentiles and heap use per command.
+//
+//   pio run -e native && .pio/build/native/program [mix files...]
+//
+// Without arguments it runs bench/mixes/*.mix from the project directory.
+// Each mix line is "<topic> <payload>"; lines starting with '#' are
+// comments. $NOW+n in a payload becomes the epoch ms n ms ahead, filled in
+// just before delivery. Only the callback is timed; loop() runs between
+// commands so publishes and timed commands drain as on the board.
+
+#include <Arduino.h>
+#include <PubSubClient.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "../clocksync.h"
+#include "../mqttlink.h"
+#include "hostalloc.h"
+
+extern PubSubClient mqttClient;
+void setup();
+void loop();
+
+static const int ROUNDS = 2000;
+static const char* const DEFAULT_MIXES[] = {
+  "bench/mixes/keywords.mix",
+  "bench/mixes/json.mix",
+  "bench/mixes/fleet.mix",
+};
+
+struct MixCommand {
+  std::string topic;
+  std::string payload;
+};
+
+static bool loadMix(const char* path, std::vector<MixCommand>& mix) {
+  FILE* f = fopen(path, "r");
+  if (f == nullptr) {
+    return false;
+  }
+  char line[1024];
+  while (fgets(line, sizeof(line), f) != nullptr) {
+    size_t n = strcspn(line, "\r\n");
+    line[n] = '\0';
+    if (line[0] == '#' || line[0] == '\0') {
+      continue;
+    }
+    const char* space = strchr(line, ' ');
+    MixCommand c;
+    c.topic.assign(line, space != nullptr ? space - line : n);
+    c.payload = space != nullptr ? space + 1 : "";
+    mix.push_back(c);
+  }
+  fclose(f);
+  return !mix.empty();
+}
+
+// Replaces every $NOW+n with an absolute epoch ms timestamp
+static void expandPayload(const std::string& in, std::string& out) {
+  out.clear();
+  size_t i = 0;
+  while (i < in.size()) {
+    if (in.compare(i, 5, "$NOW+") == 0) {
+      char* end;
+      long ahead = strtol(in.c_str() + i + 5, &end, 10);
+      out += std::to_string(epochMs() + ahead);
+      i = end - in.c_str();
+    } else {
+      out += in[i++];
+    }
+  }
+}
+
+static void runMix(const char* path) {
+  std::vector<MixCommand> mix;
+  if (!loadMix(path, mix)) {
+    printf("%-28s cannot read\n", path);
+    return;
+  }
+
+  std::vector<double> latencyUs;
+  latencyUs.reserve(mix.size() * ROUNDS);
+  uint64_t allocations = 0;
+  uint64_t allocatedBytes = 0;
+  int64_t peakBytes = 0;
+  double totalUs = 0;
+  std::string payload;
+  payload.reserve(1024);
+
+  for (int round = 0; round < ROUNDS; round++) {
+    for (const MixCommand& c : mix) {
+      expandPayload(c.payload, payload);
+      hostAllocReset();
+      auto t0 = std::chrono::steady_clock::now();
+      mqttClient.deliver(c.topic.c_str(), (const uint8_t*)payload.data(), payload.size());
+      auto t1 = std::chrono::steady_clock::now();
+      HostAllocStats heap = hostAllocStats();
+
+      double us = std::chrono::duration<double, std::micro>(t1 - t0).count();
+      latencyUs.push_back(us);
+      totalUs += us;
+      allocations += heap.allocations;
+      allocatedBytes += heap.bytes;
+      peakBytes = std::max(peakBytes, heap.peakBytes);
+      loop();
+    }
+  }
+
+  std::sort(latencyUs.begin(), latencyUs.end());
+  size_t n = latencyUs.size();
+  const char* name = strrchr(path, '/') != nullptr ? strrchr(path, '/') + 1 : path;
+  printf("%-14s %6zu %12.0f %9.2f %9.2f %9.2f %10.2f %10.1f %9lld\n", name, mix.size(), n / (totalUs / 1e6),
+         latencyUs[n / 2], latencyUs[n * 99 / 100], latencyUs[n - 1], (double)allocations / n,
+         (double)allocatedBytes / n, (long long)peakBytes);
+}
+
+int main(int argc, char** argv) {
+  Serial.quiet = true;
+  setup();
+  // WiFi and the MQTT link come up through loop() as on the board
+  uint32_t start = millis();
+  while (!mqttLink.up() && millis() - start < 10000) {
+    loop();
+    delay(1);
+  }
+  if (!mqttLink.up()) {
+    fprintf(stderr, "MQTT link did not come up\n");
+    return 1;
+  }
+
+  printf("%d rounds per mix%s\n\n", ROUNDS, hostAllocSupported() ? "" : " (no allocation counts on this libc)");
+  printf("%-14s %6s %12s %9s %9s %9s %10s %10s %9s\n", "mix", "cmds", "cmds/s", "p50 us", "p99 us", "max us",
+         "allocs/cmd", "bytes/cmd", "peak B");
+  if (argc > 1) {
+    for (int i = 1; i < argc; i++) {
+      runMix(argv[i]);
+    }
+  } else {
+    for (const char* path : DEFAULT_MIXES) {
+      runMix(path);
+    }
+  }
+  printf("\n%u publishes, %u bytes\n", (unsigned)mqttClient.published, (unsigned)mqttClient.publishedBytes);
+  fflush(stdout);
+  return 0;
+}
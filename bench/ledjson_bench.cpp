@@ -0,0 +1,85 @@
+// Host benchmark: ledjson.h reader vs. the old String/indexOf parsing
+//
+//   g++ -O2 -std=gnu++17 -I. bench/ledjson_bench.cpp -o ledjson_bench && ./ledjson_bench
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include "../ledjson.h"
+#include "benchtime.h"
+
+static size_t allocations = 0;
+
+void* operator new(size_t n) {
+  allocations++;
+  void* p = malloc(n);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+// The old firmware path: copy the payload into a String, then indexOf() +
+// substring().toInt() per channel. std::string stands in for Arduino
+// String (same copy/allocation pattern). It only knows r/g/b, so payloads
+// without them are timed for ledjson alone.
+static bool legacyParse(const char* payload, size_t length, int& r, int& g, int& b) {
+  std::string command;
+  for (size_t i = 0; i < length; i++) {
+    command += payload[i];
+  }
+  size_t rPos = command.find("\"r\":");
+  size_t gPos = command.find("\"g\":");
+  size_t bPos = command.find("\"b\":");
+  if (rPos == std::string::npos || gPos == std::string::npos || bPos == std::string::npos) {
+    return false;
+  }
+  r = atoi(command.substr(rPos + 4).c_str());
+  g = atoi(command.substr(gPos + 4).c_str());
+  b = atoi(command.substr(bPos + 4).c_str());
+  return true;
+}
+
+template <typename Fn>
+static void run(const char* name, const char* payload, int iterations, Fn fn) {
+  size_t len = strlen(payload);
+  size_t before = allocations;
+  double ns = nsPerRun(iterations, [&] { sink += fn(payload, len); });
+  printf("  %-8s %8.1f ns/op  %5.2f allocs/op\n", name, ns,
+         (double)(allocations - before) / iterations);
+}
+
+int main(int argc, char** argv) {
+  const int iterations = argc > 1 ? atoi(argv[1]) : 1000000;
+
+  const char* payloads[] = {
+    "{\"r\":255,\"g\":128,\"b\":0}",
+    "{ \"b\": 10, \"g\": 20, \"r\": 30 }",
+    "{\"state\":\"on\",\"r\":255,\"g\":64,\"b\":0,\"brightness\":120,\"transition_ms\":500}",
+    "{\"start\":0,\"pixels\":[[255,0,0],[0,255,0],[0,0,255],[255,255,255],[1,2,3],[4,5,6],[7,8,9],[10,11,12]]}",
+  };
+
+  for (const char* payload : payloads) {
+    printf("%s\n", payload);
+    int r0, g0, b0;
+    if (legacyParse(payload, strlen(payload), r0, g0, b0)) {
+      run("legacy", payload, iterations, [](const char* p, size_t n) {
+        int r = 0, g = 0, b = 0;
+        return legacyParse(p, n, r, g, b) ? (unsigned)(r + g + b) : 0u;
+      });
+    }
+    run("ledjson", payload, iterations, [](const char* p, size_t n) {
+      LEDCommand cmd;
+      if (!parseLEDCommand(p, n, cmd)) {
+        return 0u;
+      }
+      unsigned sum = cmd.red + cmd.green + cmd.blue + cmd.brightness;
+      forEachPixel(cmd, [&sum](size_t, uint8_t r, uint8_t g, uint8_t b) { sum += r + g + b; });
+      return sum;
+    });
+  }
+  return 0;
+}
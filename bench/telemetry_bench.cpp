@@ -0,0 +1,77 @@
+// Host benchmark for the status topic encodings (telemetry.h): snprintf
+// JSON as published before, the schema's JSON writer and CBOR
+//
+//   g++ -O2 -std=gnu++17 -I. bench/telemetry_bench.cpp -o telemetry_bench && ./telemetry_bench
+
+#include <cstdio>
+#include <cstring>
+#include "../telemetry.h"
+#include "benchtime.h"
+
+static const int ITERATIONS = 200000;
+
+template <typename Msg, typename Legacy>
+static void run(const char* name, Msg msg, Legacy legacy) {
+  char buf[384];
+  int legacyLen = legacy(msg, buf, sizeof(buf));
+  char legacyJson[384];
+  memcpy(legacyJson, buf, legacyLen + 1);
+
+  JsonWriter jw(buf, sizeof(buf));
+  int jsonLen = encode(jw, msg);
+  if (strcmp(buf, legacyJson) != 0) {
+    printf("%s: JSON differs from snprintf\n  %s\n  %s\n", name, legacyJson, buf);
+  }
+  CborWriter cw(buf, sizeof(buf));
+  int cborLen = encode(cw, msg);
+
+  double tLegacy = nsPerRun(ITERATIONS, [&] { sink = legacy(msg, buf, sizeof(buf)); });
+  double tJson = nsPerRun(ITERATIONS, [&] { JsonWriter w(buf, sizeof(buf)); sink = encode(w, msg); });
+  double tCbor = nsPerRun(ITERATIONS, [&] { CborWriter w(buf, sizeof(buf)); sink = encode(w, msg); });
+
+  printf("%-14s snprintf %4d B %7.1f ns | json %4d B %7.1f ns | cbor %4d B %7.1f ns (%.0f%% of json)\n", name, legacyLen,
+         tLegacy, jsonLen, tJson, cborLen, tCbor, 100.0 * cborLen / jsonLen);
+}
+
+int main() {
+  LEDStatusMsg led = {"on", "magenta", "2024-05-01 12:34:56", "IIOT_V4_Board", 2};
+  run("led status", led, [](const LEDStatusMsg& m, char* buf, size_t len) {
+    return snprintf(buf, len, "{\"state\":\"%s\",\"color\":\"%s\",\"timestamp\":\"%s\",\"device\":\"%s\",\"late_ms\":%d}",
+                    m.state, m.color, m.timestamp, m.device, m.lateMs);
+  });
+
+  DeviceStatusMsg status = {"IIOT_V4_Board", "192.168.1.57", -61, 86400, 182344, 3, 2140, 4, 12, 830, 5120, 94000};
+  run("device status", status, [](const DeviceStatusMsg& m, char* buf, size_t len) {
+    return snprintf(buf, len,
+                    "{\"device\":\"%s\",\"ip\":\"%s\",\"rssi\":%d,\"uptime\":%u,\"free_heap\":%u,\"reconnects\":%u,"
+                    "\"loop_max_us\":%u,\"mqtt_connects\":%u,\"mqtt_failures\":%u,\"connect_ms\":%u,"
+                    "\"max_connect_ms\":%u,\"outage_ms\":%u}",
+                    m.device, m.ip, m.rssi, m.uptime, m.freeHeap, m.reconnects, m.loopMaxUs, m.mqttConnects,
+                    m.mqttFailures, m.connectMs, m.maxConnectMs, m.outageMs);
+  });
+
+  TelemetryDataMsg data = {"IIOT_V4_Board", 1234, 86400, -61, 1, "on", 255, 128, 0};
+  run("telemetry", data, [](const TelemetryDataMsg& m, char* buf, size_t len) {
+    return snprintf(buf, len,
+                    "{\"device\":\"%s\",\"count\":%u,\"uptime\":%u,\"rssi\":%d,\"button\":%u,\"led\":\"%s\",\"r\":%u,"
+                    "\"g\":%u,\"b\":%u}",
+                    m.device, m.count, m.uptime, m.rssi, m.button, m.led, m.r, m.g, m.b);
+  });
+
+  // Spot check the CBOR framing: map of 6 pairs, 0 => kind 1, 1 => "on",
+  // ending in 4 => "IIOT_V4_Board", 5 => 2
+  char buf[64];
+  CborWriter w(buf, sizeof(buf));
+  int n = encode(w, led);
+  const uint8_t expect[] = {0xA6, 0x00, 0x01, 0x01, 0x62, 'o', 'n'};
+  if (memcmp(buf, expect, sizeof(expect)) != 0) {
+    printf("unexpected CBOR header\n");
+    return 1;
+  }
+  const uint8_t expectTail[] = {0x04, 0x6D, 'I', 'I', 'O', 'T', '_', 'V', '4', '_', 'B', 'o', 'a', 'r', 'd', 0x05, 0x02};
+  if (n < (int)sizeof(expectTail) || memcmp(buf + n - sizeof(expectTail), expectTail, sizeof(expectTail)) != 0) {
+    printf("unexpected CBOR device/late_ms fields\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,126 @@
+// Host benchmark for the MQTT topic matcher (topictrie.h) against a
+// linear scan that tests every filter in turn, as more device filters
+// are registered
+//
+//   g++ -O2 -std=gnu++17 -I. bench/topictrie_bench.cpp topictrie.cpp -o topictrie_bench && ./topictrie_bench
+
+#include <cstdio>
+#include <cstring>
+#include "../topictrie.h"
+#include "benchtime.h"
+
+static const int ITERATIONS = 1000000;
+
+// Reference matcher, one filter at a time
+static bool filterMatches(const char* f, const char* t, const char* end) {
+  while (*f != '\0') {
+    if (f[0] == '#') {
+      return true;
+    }
+    const char* slash = (const char*)memchr(t, '/', end - t);
+    const char* levelEnd = slash != nullptr ? slash : end;
+    if (f[0] == '+') {
+      f++;
+    } else {
+      size_t n = levelEnd - t;
+      if (strncmp(f, t, n) != 0 || (f[n] != '/' && f[n] != '\0')) {
+        return false;
+      }
+      f += n;
+    }
+    if (*f == '\0') {
+      return slash == nullptr;
+    }
+    if (slash == nullptr) {
+      return strcmp(f, "/#") == 0;
+    }
+    f++;
+    t = slash + 1;
+  }
+  return false;
+}
+
+struct Check {
+  const char* topic;
+  uint8_t id;
+};
+
+int main() {
+  TopicTrie trie;
+  trie.add("home/led/command", 0);
+  trie.add("homeled/control", 1);
+  trie.add("home/led/dev0/set", 2);
+  trie.add("home/led/dev0/+/set", 3);
+  trie.add("home/led/group/all/set", 4);
+  trie.add("home/#", 5);
+
+  const Check checks[] = {
+    {"home/led/command", 0},
+    {"homeled/control", 1},
+    {"home/led/dev0/set", 2},
+    {"home/led/dev0/3/set", 3},
+    {"home/led/group/all/set", 4},
+    {"home/led/dev1/set", 5},
+    {"home", 5},
+    {"home/led/dev0/3/get", 5},
+    {"office/led", TOPIC_NO_MATCH},
+    {"$SYS/home", TOPIC_NO_MATCH},
+  };
+  int failures = 0;
+  for (const Check& c : checks) {
+    TopicMatch m;
+    uint8_t id = trie.match(c.topic, strlen(c.topic), m);
+    if (id != c.id) {
+      printf("FAIL %s -> %d, expected %d\n", c.topic, id, c.id);
+      failures++;
+    }
+  }
+  TopicMatch m;
+  trie.match("home/led/dev0/12/set", 20, m);
+  if (m.count != 1 || m.wildcardLength[0] != 2 || memcmp(m.wildcard[0], "12", 2) != 0) {
+    printf("FAIL segment capture\n");
+    failures++;
+  }
+  printf("%d checks, %d failures, %u nodes\n\n", (int)(sizeof(checks) / sizeof(checks[0])) + 1, failures, trie.nodeCount());
+
+  // Each device adds "<prefix>/devN/set" and "<prefix>/devN/+/set"; the
+  // topic looked up belongs to the last device registered
+  printf("%8s %12s %12s\n", "filters", "trie ns", "linear ns");
+  char filters[16][2][32];
+  for (int devices = 1; devices <= 14; devices++) {
+    TopicTrie t;
+    int n = 0;
+    for (int d = 0; d < devices; d++) {
+      snprintf(filters[d][0], sizeof(filters[d][0]), "home/led/dev%d/set", d);
+      snprintf(filters[d][1], sizeof(filters[d][1]), "home/led/dev%d/+/set", d);
+      if (!t.add(filters[d][0], 0) || !t.add(filters[d][1], 1)) {
+        break;
+      }
+      n = d + 1;
+    }
+    if (n != devices) {
+      break;
+    }
+    char topic[32];
+    int len = snprintf(topic, sizeof(topic), "home/led/dev%d/2/set", devices - 1);
+
+    double trieNs = nsPerRun(ITERATIONS, [&] {
+      TopicMatch m;
+      sink = t.match(topic, len, m);
+    });
+    double linearNs = nsPerRun(ITERATIONS, [&] {
+      int id = -1;
+      for (int d = 0; d < devices && id < 0; d++) {
+        for (int k = 0; k < 2; k++) {
+          if (filterMatches(filters[d][k], topic, topic + len)) {
+            id = k;
+            break;
+          }
+        }
+      }
+      sink = id;
+    });
+    printf("%8d %12.1f %12.1f\n", devices * 2, trieNs, linearNs);
+  }
+  return failures == 0 ? 0 : 1;
+}
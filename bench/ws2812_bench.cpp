@@ -0,0 +1,51 @@
+// Host benchmark and round-trip check for the WS2812 RMT bit encoder
+//
+//   g++ -O2 -std=gnu++17 -I. bench/ws2812_bench.cpp -o ws2812_bench && ./ws2812_bench
+
+#include <cstdio>
+#include <cstdlib>
+#include <initializer_list>
+#include <vector>
+#include "../ws2812encode.h"
+#include "benchtime.h"
+
+// Straightforward per-bit version, for comparison
+static void naiveEncode(const uint8_t* src, size_t length, uint32_t* dst, const WS2812Timing& t) {
+  for (size_t i = 0; i < length; i++) {
+    for (int bit = 7; bit >= 0; bit--) {
+      *dst++ = (src[i] >> bit) & 1 ? t.one : t.zero;
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  const int frames = argc > 1 ? atoi(argv[1]) : 2000;
+  const WS2812Timing timing = ws2812Timing(40000000);  // RMT at 80 MHz / 2
+
+  for (size_t pixels : {1, 300, 1000, 2000}) {
+    std::vector<uint8_t> src(pixels * 3), back(pixels * 3);
+    std::vector<uint32_t> symbols(pixels * 24);
+    for (size_t i = 0; i < src.size(); i++) {
+      src[i] = (uint8_t)rand();
+    }
+
+    ws2812Encode(src.data(), src.size(), symbols.data(), timing);
+    bool ok = ws2812Decode(symbols.data(), src.size(), back.data(), timing) && back == src;
+
+    double fast = nsPerRun(frames, [&] {
+      ws2812Encode(src.data(), src.size(), symbols.data(), timing);
+      sink += symbols[pixels];
+    });
+    double naive = nsPerRun(frames, [&] {
+      naiveEncode(src.data(), src.size(), symbols.data(), timing);
+      sink += symbols[pixels];
+    });
+
+    printf("%5zu px: encode %9.1f ns/frame (%.2f ns/px), naive %9.1f ns/frame, wire time %6zu us, round-trip %s\n",
+           pixels, fast, fast / pixels, naive, pixels * 30, ok ? "OK" : "FAILED");
+    if (!ok) {
+      return 1;
+    }
+  }
+  return 0;
+}
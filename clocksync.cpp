@@ -0,0 +1,38 @@
+#include "clocksync.h"
+#include <Arduino.h>
+#include <esp_sntp.h>
+#include <sys/time.h>
+#include "config.h"
+#include "log.h"
+
+static volatile bool synced = false;
+
+// lwIP task, after every successful poll
+static void onTimeSync(struct timeval*) {
+  if (!synced) {
+    synced = true;
+    LOG_I("TIME", "✓ Clock synced via NTP");
+  }
+}
+
+void startClockSync() {
+  static bool started = false;
+  if (started) {
+    return;
+  }
+  started = true;
+  sntp_set_time_sync_notification_cb(onTimeSync);
+  sntp_set_sync_interval(NTP_SYNC_INTERVAL_MS);
+  configTime(0, 0, NTP_SERVER_1, NTP_SERVER_2);
+  LOG_I("TIME", "Syncing clock with %s", NTP_SERVER_1);
+}
+
+bool clockSynced() {
+  return synced;
+}
+
+int64_t epochMs() {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  return (int64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
+}
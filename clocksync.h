@@ -0,0 +1,21 @@
+#ifndef CLOCKSYNC_H
+#define CLOCKSYNC_H
+
+#include <stdint.h>
+
+// Wall clock kept in step with NTP by the SNTP client in lwIP. Boards in a
+// fleet agree to within a few ms on a LAN once synced, which is what lets
+// {"at": ...} commands (pendingcommands.h) change every board together.
+// The clock is UTC; localtime_r() without a TZ gives the same.
+
+// Starts SNTP on the first call; later calls (WiFi reconnects) are ignored
+// because the client keeps polling on its own
+void startClockSync();
+
+// True once the first NTP answer has set the clock
+bool clockSynced();
+
+// Milliseconds since the Unix epoch
+int64_t epochMs();
+
+#endif // CLOCKSYNC_H
@@ -0,0 +1,87 @@
+#ifndef COLORPIPELINE_H
+#define COLORPIPELINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <array>
+#include "config.h"
+
+// Color processing between the framebuffer and the strip: gamma correction
+// and global brightness folded into one 256-entry table, applied to a whole
+// span in a single pass while reordering RGB to the strip's GRB.
+
+namespace colorpipeline {
+
+// constexpr ln/exp so the gamma curve is computed by the compiler
+constexpr double ln(double x) {
+  // ln(x) = 2 * atanh((x - 1) / (x + 1)), after scaling x into [0.5, 2)
+  int k = 0;
+  while (x >= 2.0) { x /= 2.0; k++; }
+  while (x < 0.5) { x *= 2.0; k--; }
+  double y = (x - 1.0) / (x + 1.0);
+  double y2 = y * y;
+  double term = y, sum = 0.0;
+  for (int n = 1; n < 60; n += 2) {
+    sum += term / n;
+    term *= y2;
+  }
+  return 2.0 * sum + k * 0.69314718055994530942;
+}
+
+constexpr double exp(double x) {
+  // e^x = (e^(x/2^k))^(2^k), series on the reduced argument
+  int k = 0;
+  while (x > 0.5 || x < -0.5) { x /= 2.0; k++; }
+  double term = 1.0, sum = 1.0;
+  for (int n = 1; n < 30; n++) {
+    term *= x / n;
+    sum += term;
+  }
+  for (int i = 0; i < k; i++) {
+    sum *= sum;
+  }
+  return sum;
+}
+
+constexpr std::array<uint8_t, 256> makeGammaTable(double gamma) {
+  std::array<uint8_t, 256> t{};
+  for (int i = 1; i < 256; i++) {
+    double v = exp(gamma * ln(i / 255.0)) * 255.0 + 0.5;
+    t[i] = v > 255.0 ? 255 : (uint8_t)v;
+  }
+  return t;
+}
+
+}  // namespace colorpipeline
+
+constexpr std::array<uint8_t, 256> GAMMA_TABLE = colorpipeline::makeGammaTable(LED_GAMMA);
+
+static_assert(GAMMA_TABLE[0] == 0 && GAMMA_TABLE[255] == 255, "gamma table endpoints");
+
+// Combined gamma + brightness table; rebuilt only when brightness changes
+inline void buildColorLUT(uint8_t* lut, uint8_t brightness) {
+  uint16_t scale = (uint16_t)brightness + 1;
+  for (int i = 0; i < 256; i++) {
+    lut[i] = (uint8_t)((GAMMA_TABLE[i] * scale) >> 8);
+  }
+}
+
+// RGB in, GRB out, through lut. Four pixels per iteration; the loop is
+// load/store bound (ESP32-S3 PIE has no byte gather, so there is nothing
+// for SIMD to win here) and runs at a few cycles per byte.
+inline void applyColorLUT(const uint8_t* rgb, uint8_t* grb, size_t pixels, const uint8_t* lut) {
+  size_t i = 0;
+  for (; i + 4 <= pixels; i += 4, rgb += 12, grb += 12) {
+    grb[0] = lut[rgb[1]];  grb[1] = lut[rgb[0]];  grb[2] = lut[rgb[2]];
+    grb[3] = lut[rgb[4]];  grb[4] = lut[rgb[3]];  grb[5] = lut[rgb[5]];
+    grb[6] = lut[rgb[7]];  grb[7] = lut[rgb[6]];  grb[8] = lut[rgb[8]];
+    grb[9] = lut[rgb[10]]; grb[10] = lut[rgb[9]]; grb[11] = lut[rgb[11]];
+  }
+  for (; i < pixels; i++, rgb += 3, grb += 3) {
+    grb[0] = lut[rgb[1]];
+    grb[1] = lut[rgb[0]];
+    grb[2] = lut[rgb[2]];
+  }
+}
+
+#endif // COLORPIPELINE_H
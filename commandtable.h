@@ -0,0 +1,148 @@
+#ifndef COMMANDTABLE_H
+#define COMMANDTABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <array>
+#include "config.h"
+#include "effects.h"
+
+// Compile-time lookup tables for command words, plus the ids MQTT topics
+// map to (topics themselves are matched by topictrie.h).
+// Each table is sorted by name at compile time and searched with a binary
+// search directly on the (pointer, length) of the incoming buffer, so the
+// payload never has to be copied or NUL-terminated.
+
+enum TopicId : uint8_t {
+  TOPIC_COMMAND,
+  TOPIC_LED_CONTROL,
+  TOPIC_DEVICE_SET,
+  TOPIC_SEGMENT_SET,
+  TOPIC_GROUP_SET,
+  TOPIC_UNKNOWN
+};
+
+enum CommandId : uint8_t {
+  CMD_BUZZER_ON,
+  CMD_BUZZER_OFF,
+  CMD_STATUS,
+  CMD_LED_STATUS,
+  CMD_RESTART,
+  CMD_TEST_NETWORK,
+  CMD_UNKNOWN
+};
+
+enum LEDCommandId : uint8_t {
+  LED_CMD_ON,
+  LED_CMD_OFF,
+  LED_CMD_COLOR,
+  LED_CMD_UNKNOWN
+};
+
+struct TableEntry {
+  const char* name;
+  uint8_t len;
+  uint8_t id;
+  uint8_t r, g, b;  // only used by the LED table
+};
+
+constexpr size_t constLength(const char* s) {
+  size_t n = 0;
+  while (s[n] != '\0') {
+    n++;
+  }
+  return n;
+}
+
+constexpr TableEntry entry(const char* name, uint8_t id, uint8_t r = 0, uint8_t g = 0, uint8_t b = 0) {
+  return TableEntry{name, (uint8_t)constLength(name), id, r, g, b};
+}
+
+// Byte-wise ordering, shorter string first on a common prefix
+constexpr int compareName(const char* a, size_t alen, const char* b, size_t blen) {
+  size_t n = alen < blen ? alen : blen;
+  for (size_t i = 0; i < n; i++) {
+    if ((uint8_t)a[i] != (uint8_t)b[i]) {
+      return (uint8_t)a[i] < (uint8_t)b[i] ? -1 : 1;
+    }
+  }
+  return alen == blen ? 0 : (alen < blen ? -1 : 1);
+}
+
+template <size_t N>
+constexpr std::array<TableEntry, N> sortedTable(std::array<TableEntry, N> t) {
+  for (size_t i = 1; i < N; i++) {
+    for (size_t j = i; j > 0 && compareName(t[j].name, t[j].len, t[j - 1].name, t[j - 1].len) < 0; j--) {
+      TableEntry tmp = t[j];
+      t[j] = t[j - 1];
+      t[j - 1] = tmp;
+    }
+  }
+  return t;
+}
+
+template <size_t N>
+inline const TableEntry* findEntry(const std::array<TableEntry, N>& table, const char* key, size_t len) {
+  size_t lo = 0, hi = N;
+  while (lo < hi) {
+    size_t mid = (lo + hi) / 2;
+    int c = compareName(key, len, table[mid].name, table[mid].len);
+    if (c == 0) {
+      return &table[mid];
+    }
+    if (c < 0) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return nullptr;
+}
+
+constexpr auto COMMAND_TABLE = sortedTable(std::array<TableEntry, 6>{{
+  entry("buzzer_on", CMD_BUZZER_ON),
+  entry("buzzer_off", CMD_BUZZER_OFF),
+  entry("status", CMD_STATUS),
+  entry("led_status", CMD_LED_STATUS),
+  entry("restart", CMD_RESTART),
+  entry("test_network", CMD_TEST_NETWORK),
+}});
+
+constexpr auto LED_COMMAND_TABLE = sortedTable(std::array<TableEntry, 9>{{
+  entry("on", LED_CMD_ON),
+  entry("off", LED_CMD_OFF),
+  entry("red", LED_CMD_COLOR, 255, 0, 0),
+  entry("green", LED_CMD_COLOR, 0, 255, 0),
+  entry("blue", LED_CMD_COLOR, 0, 0, 255),
+  entry("white", LED_CMD_COLOR, 255, 255, 255),
+  entry("yellow", LED_CMD_COLOR, 255, 255, 0),
+  entry("cyan", LED_CMD_COLOR, 0, 255, 255),
+  entry("magenta", LED_CMD_COLOR, 255, 0, 255),
+}});
+
+constexpr auto EFFECT_TABLE = sortedTable(std::array<TableEntry, 5>{{
+  entry("none", EFFECT_NONE),
+  entry("fade", EFFECT_FADE),
+  entry("breathe", EFFECT_BREATHE),
+  entry("chase", EFFECT_CHASE),
+  entry("rainbow", EFFECT_RAINBOW),
+}});
+
+inline CommandId lookupCommand(const char* cmd, size_t len) {
+  const TableEntry* e = findEntry(COMMAND_TABLE, cmd, len);
+  return e ? (CommandId)e->id : CMD_UNKNOWN;
+}
+
+// Returns nullptr for anything that is not a plain LED keyword
+inline const TableEntry* lookupLEDCommand(const char* cmd, size_t len) {
+  return findEntry(LED_COMMAND_TABLE, cmd, len);
+}
+
+// Unknown names map to EFFECT_NONE
+inline uint8_t lookupEffect(const char* name, size_t len) {
+  const TableEntry* e = findEntry(EFFECT_TABLE, name, len);
+  return e ? e->id : (uint8_t)EFFECT_NONE;
+}
+
+#endif // COMMANDTABLE_H
@@ -18,15 +18,119 @@
 #define MQTT_TOPIC_LED_STATUS "home/led/status"
 #define MQTT_TOPIC_LED_CONTROL "homeled/control"
 #define MQTT_TOPIC_COMMAND "home/led/command"
+#define MQTT_TOPIC_METRICS "home/led/metrics"
+// Addressed control, same payloads as MQTT_TOPIC_LED_CONTROL:
+//   <prefix>/<DEVICE_NAME>/set            whole strip
+//   <prefix>/<DEVICE_NAME>/<segment>/set  one segment
+//   <prefix>/group/<name>/set             every device in the group
+#define MQTT_TOPIC_DEVICE_PREFIX "home/led"
+#define LED_GROUPS { "all" }
+
+// Topic matcher pools (topictrie.h); edges must be a power of two
+#define TOPIC_TRIE_NODES 32
+#define TOPIC_TRIE_EDGES 64
+#define TOPIC_TRIE_LABEL_BYTES 256
+#define TOPIC_MAX_WILDCARDS 4
 
 // Device Configuration
 #define DEVICE_NAME "IIOT_V4_Board"
 #define SERIAL_BAUD_RATE 115200
 #define PUBLISH_INTERVAL 5000  // milliseconds
 
+// Outbound MQTT (publishqueue.h): updates within the window are merged
+// into one publish; a flush goes out as a single write of up to the cork
+// buffer size
+#define MQTT_COALESCE_MS 100
+#define MQTT_PUBLISH_BUFFER 768  // sized for the metrics payload (metrics.h)
+#define MQTT_CORK_BUFFER 1024
+// Connect attempts run on their own task (mqttlink.h) and back off
+// exponentially with jitter between these bounds
+#define MQTT_BACKOFF_MIN_MS 1000
+#define MQTT_BACKOFF_MAX_MS 60000
+#define MQTT_DIAGNOSTICS_EVERY 10  // failed attempts between network checks
+#define MQTT_CONNECT_TASK_STACK 6144
+#define MQTT_CONNECT_TASK_PRIORITY 1
+
+// Host name cache (dnscache.h); lookups are refreshed in the background
+#define DNS_CACHE_SIZE 4
+#define DNS_HOST_MAX 64
+#define DNS_REFRESH_MS 300000
+#define DNS_RETRY_MS 10000
+#define DNS_TASK_STACK 4096
+#define DNS_TASK_PRIORITY 1
+// Fleet timing (clocksync.h, pendingcommands.h): LED commands carrying
+// {"at": epoch ms} wait for that NTP time so a group changes together
+#define NTP_SERVER_1 "pool.ntp.org"
+#define NTP_SERVER_2 "time.google.com"
+#define NTP_SYNC_INTERVAL_MS 900000
+#define PENDING_COMMAND_SLOTS 8
+#define PENDING_COMMAND_MAX 256  // longer payloads apply immediately
+#define PENDING_MAX_AHEAD_MS 60000  // later targets are dropped as bogus
+
+// Status topic payloads (telemetry.h): TELEMETRY_JSON or TELEMETRY_CBOR
+#define TELEMETRY_FORMAT TELEMETRY_JSON
+
+// Store-and-forward for telemetry while the broker is away (outbox.h).
+// RAM holds the newest records, the LittleFS ring file the older ones
+// (720 x 200 bytes, one hour at PUBLISH_INTERVAL). Replay sends
+// OUTBOX_REPLAY_BATCH records every OUTBOX_REPLAY_INTERVAL_MS.
+#define OUTBOX_PAYLOAD_MAX 192
+#define OUTBOX_RAM_RECORDS 16
+#define OUTBOX_FILE_RECORDS 720
+#define OUTBOX_DROP_POLICY OUTBOX_DROP_OLDEST
+#define OUTBOX_REPLAY_BATCH 5
+#define OUTBOX_REPLAY_INTERVAL_MS 200
+
 // WS2812B LED Configuration
 #define NUM_LEDS 1  // Number of LEDs in your strip
 #define LED_BRIGHTNESS 50  // 0-255
+#define LED_GAMMA 2.2  // applied by the renderer (colorpipeline.h), 1.0 = off
+// true: asynchronous RMT output (ws2812driver.cpp), false: Adafruit_NeoPixel
+#define LED_DRIVER_RMT true
+// Addressable parts of the strip as {start, count}; the index is the
+// segment id used by {"segment":n} (MQTT) and ?segment=n (HTTP)
+#define LED_SEGMENTS { {0, NUM_LEDS} }
+
+// Render task (effects + strip output). loop() runs on core 1, so the
+// renderer gets the other core by default.
+#define RENDER_FPS 50
+#define RENDER_TASK_CORE 0
+#define RENDER_TASK_PRIORITY 2
+
+// Web sessions. Capacity is the hash table size (power of two); up to
+// 3/4 of it can be logged in at once before the oldest is evicted.
+#define SESSION_CAPACITY 16
+#define SESSION_TIMEOUT_MS 3600000UL
+
+// Activity log ring (16 bytes per entry)
+#define LOG_CAPACITY 64
+
+// Async serial log (log.h). LOG_LEVEL itself comes from platformio.ini.
+#define LOG_QUEUE_SLOTS 32  // power of two
+#define LOG_LINE_MAX 128
+#define LOG_FLUSH_INTERVAL_MS 10
+#define LOG_TASK_PRIORITY 1
+
+// loop() scheduler (scheduler.h): 10 ms ticks, 64 slots = 640 ms per turn
+#define SCHEDULER_TICK_MS 10
+#define SCHEDULER_WHEEL_SLOTS 64
+#define SCHEDULER_MAX_TIMERS 16
+#define LOOP_BUDGET_US 20000
+#define LOOP_REPORT_INTERVAL 60000
+
+// Metrics (metrics.h): histogram bucket bounds in microseconds, shared by
+// every timing, and how often the compact set goes to MQTT_TOPIC_METRICS
+#define METRIC_BUCKETS_US { 50, 100, 250, 500, 1000, 2500, 5000, 10000, 20000, 50000 }
+#define METRICS_PUBLISH_INTERVAL_MS 60000
+
+// HTTP server (httpserver.h): per-connection buffers are static
+#define HTTP_MAX_CONNECTIONS 4
+#define HTTP_REQUEST_BUFFER 1024
+#define HTTP_RESPONSE_BUFFER 1024
+#define HTTP_KEEPALIVE_TIMEOUT_MS 5000
+#define HTTP_REQUEST_TIMEOUT_MS 3000
+#define HTTP_WRITE_TIMEOUT_MS 2000
+#define HTTP_MAX_REQUESTS_PER_CONNECTION 100
 
 // Feature Flags
 #define ENABLE_BUZZER true
@@ -0,0 +1,40 @@
+#include "corkedclient.h"
+#include <string.h>
+
+size_t CorkedClient::write(const uint8_t* buf, size_t size) {
+  if (!corked_) {
+    return inner_.write(buf, size);
+  }
+  if (len_ + size > sizeof(buf_)) {
+    // Full: send what is held and, if this packet alone is too big, let it
+    // go straight through
+    if (!drain()) {
+      return 0;
+    }
+    if (size > sizeof(buf_)) {
+      return inner_.write(buf, size);
+    }
+  }
+  memcpy(buf_ + len_, buf, size);
+  len_ += size;
+  return size;
+}
+
+bool CorkedClient::drain() {
+  if (len_ == 0) {
+    return true;
+  }
+  size_t sent = inner_.write(buf_, len_);
+  bool ok = sent == len_;
+  len_ = 0;
+  drains_++;
+  if (!ok) {
+    failed_ = true;
+  }
+  return ok;
+}
+
+bool CorkedClient::uncork() {
+  corked_ = false;
+  return drain() && !failed_;
+}
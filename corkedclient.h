@@ -0,0 +1,52 @@
+#ifndef CORKEDCLIENT_H
+#define CORKEDCLIENT_H
+
+#include <Client.h>
+#include "config.h"
+
+// Client wrapper that can hold back writes. Between cork() and uncork()
+// everything written is collected and then handed to the socket in one
+// write, so a batch of MQTT publishes leaves as one TCP segment instead of
+// one per packet. Uncorked it is a plain pass-through.
+class CorkedClient : public Client {
+ public:
+  explicit CorkedClient(Client& inner) : inner_(inner), corked_(false), failed_(false), len_(0), drains_(0) {}
+
+  void cork() { corked_ = true; failed_ = false; }
+  // Sends whatever was collected; false if the socket took less, here or
+  // in a drain since cork(). Part of a packet may be out then, so the
+  // stream is no longer usable.
+  bool uncork();
+
+  // A write that does not fit drains the held bytes first: everything
+  // written before a change in drains() is on the wire, and held() is
+  // what is still waiting for uncork()
+  uint16_t drains() const { return drains_; }
+  size_t held() const { return len_; }
+
+  int connect(IPAddress ip, uint16_t port) override { len_ = 0; return inner_.connect(ip, port); }
+  int connect(const char* host, uint16_t port) override { len_ = 0; return inner_.connect(host, port); }
+  size_t write(uint8_t b) override { return write(&b, 1); }
+  size_t write(const uint8_t* buf, size_t size) override;
+  int available() override { return inner_.available(); }
+  int read() override { return inner_.read(); }
+  int read(uint8_t* buf, size_t size) override { return inner_.read(buf, size); }
+  int peek() override { return inner_.peek(); }
+  void flush() override { inner_.flush(); }
+  void stop() override { len_ = 0; corked_ = false; inner_.stop(); }
+  uint8_t connected() override { return inner_.connected(); }
+  operator bool() override { return (bool)inner_; }
+  using Print::write;
+
+ private:
+  bool drain();
+
+  Client& inner_;
+  bool corked_;
+  bool failed_;
+  size_t len_;
+  uint16_t drains_;
+  uint8_t buf_[MQTT_CORK_BUFFER];
+};
+
+#endif // CORKEDCLIENT_H
@@ -0,0 +1,160 @@
+#include "dnscache.h"
+#include <Arduino.h>
+#include <WiFi.h>
+#include <string.h>
+#include "log.h"
+
+DnsCache dnsCache;
+
+DnsCache::DnsCache() : entries_(), mutex_(nullptr), task_(nullptr) {}
+
+void DnsCache::begin() {
+  if (task_ != nullptr) {
+    return;
+  }
+  mutex_ = xSemaphoreCreateMutexStatic(&mutexBuffer_);
+  xTaskCreate(taskEntry, "dns", DNS_TASK_STACK, this, DNS_TASK_PRIORITY, &task_);
+}
+
+bool DnsCache::lookup(const char* host, IPAddress& ip) {
+  if (ip.fromString(host)) {
+    return true;
+  }
+
+  bool known = false;
+  bool wake = false;
+  xSemaphoreTake(mutex_, portMAX_DELAY);
+  DnsEntry* e = find(host);
+  if (e == nullptr) {
+    e = add(host);
+  }
+  if (e != nullptr) {
+    known = e->valid;
+    if (known) {
+      ip = e->ip;
+    }
+    if (!e->wanted && due(*e, millis())) {
+      e->wanted = true;
+      wake = true;
+    }
+  }
+  xSemaphoreGive(mutex_);
+
+  if (wake) {
+    xTaskNotifyGive(task_);
+  }
+  return known;
+}
+
+void DnsCache::refreshAll() {
+  xSemaphoreTake(mutex_, portMAX_DELAY);
+  for (DnsEntry& e : entries_) {
+    if (e.host[0] != '\0') {
+      e.wanted = true;
+    }
+  }
+  xSemaphoreGive(mutex_);
+  xTaskNotifyGive(task_);
+}
+
+bool DnsCache::entry(const char* host, DnsEntry& out) {
+  xSemaphoreTake(mutex_, portMAX_DELAY);
+  DnsEntry* e = find(host);
+  if (e != nullptr) {
+    out = *e;
+  }
+  xSemaphoreGive(mutex_);
+  return e != nullptr;
+}
+
+// Stale entries are refreshed; failed ones are retried after
+// DNS_RETRY_MS so a dead resolver is not hammered on every lookup
+bool DnsCache::due(const DnsEntry& e, uint32_t now) const {
+  if (e.attemptedAt == 0) {
+    return true;
+  }
+  if (e.failures > 0) {
+    return now - e.attemptedAt >= DNS_RETRY_MS;
+  }
+  return now - e.resolvedAt >= DNS_REFRESH_MS;
+}
+
+DnsEntry* DnsCache::find(const char* host) {
+  for (DnsEntry& e : entries_) {
+    if (e.host[0] != '\0' && strcmp(e.host, host) == 0) {
+      return &e;
+    }
+  }
+  return nullptr;
+}
+
+DnsEntry* DnsCache::add(const char* host) {
+  if (strlen(host) >= DNS_HOST_MAX) {
+    LOG_W("DNS", "✗ Host name too long: %s", host);
+    return nullptr;
+  }
+  for (DnsEntry& e : entries_) {
+    if (e.host[0] == '\0') {
+      strcpy(e.host, host);
+      return &e;
+    }
+  }
+  LOG_W("DNS", "✗ Cache full, %s not cached", host);
+  return nullptr;
+}
+
+void DnsCache::taskEntry(void* arg) {
+  DnsCache* cache = (DnsCache*)arg;
+  for (;;) {
+    // Also wake up now and then to refresh entries nobody asked for lately
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(DNS_REFRESH_MS / 4));
+    cache->resolvePending();
+  }
+}
+
+// Resolver task: the lookup itself runs without the lock held
+void DnsCache::resolvePending() {
+  if (WiFi.status() != WL_CONNECTED) {
+    return;
+  }
+  for (uint8_t i = 0; i < DNS_CACHE_SIZE; i++) {
+    char host[DNS_HOST_MAX];
+    xSemaphoreTake(mutex_, portMAX_DELAY);
+    DnsEntry& e = entries_[i];
+    bool go = e.host[0] != '\0' && (e.wanted || due(e, millis()));
+    strcpy(host, e.host);
+    xSemaphoreGive(mutex_);
+    if (!go) {
+      continue;
+    }
+
+    IPAddress ip;
+    uint32_t start = millis();
+    bool ok = WiFi.hostByName(host, ip) == 1;
+    uint32_t now = millis();
+
+    xSemaphoreTake(mutex_, portMAX_DELAY);
+    uint32_t previous = e.ip;
+    e.wanted = false;
+    e.attemptedAt = now != 0 ? now : 1;
+    e.lookupMs = now - start;
+    if (ok) {
+      e.ip = ip;
+      e.valid = true;
+      e.resolvedAt = now;
+      e.failures = 0;
+    } else {
+      e.failures++;
+    }
+    uint16_t failures = e.failures;
+    bool valid = e.valid;
+    xSemaphoreGive(mutex_);
+
+    if (!ok) {
+      LOG_W("DNS", "✗ %s failed after %lu ms (%u in a row)%s", host, (unsigned long)(now - start), failures,
+            valid ? ", keeping last good address" : "");
+    } else if ((uint32_t)ip != previous) {
+      LOG_I("DNS", "✓ %s -> %s (%lu ms)", host, ip.toString().c_str(), (unsigned long)(now - start));
+    }
+  }
+}
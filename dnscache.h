@@ -0,0 +1,61 @@
+#ifndef DNSCACHE_H
+#define DNSCACHE_H
+
+#include <stdint.h>
+#include <IPAddress.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include "config.h"
+
+// Host name cache with its own resolver task. lookup() never blocks: it
+// answers from the cache and, when the entry is missing or getting old,
+// asks the resolver task to refresh it in the background. Entries are
+// refreshed after DNS_REFRESH_MS and a failed refresh keeps the last good
+// address, so a DNS outage only matters if the host was never resolved.
+// Names that are already dotted-quad addresses bypass DNS entirely.
+//
+// lwIP does not pass the record TTL up to WiFi.hostByName(), so the
+// refresh interval is a fixed setting.
+
+struct DnsEntry {
+  char host[DNS_HOST_MAX];
+  IPAddress ip;
+  uint32_t resolvedAt;   // millis() of the last successful lookup
+  uint32_t attemptedAt;  // millis() of the last lookup, 0 = never
+  uint32_t lookupMs;     // duration of the last lookup
+  uint16_t failures;     // consecutive failed lookups
+  bool valid;            // ip holds a known good address
+  bool wanted;           // refresh requested
+};
+
+class DnsCache {
+ public:
+  DnsCache();
+
+  void begin();
+
+  // Fills ip and returns true if an address is known (possibly stale).
+  // Unknown hosts are added and resolved in the background.
+  bool lookup(const char* host, IPAddress& ip);
+  // Queues a background refresh of every entry, e.g. after WiFi reconnects
+  void refreshAll();
+  // Copy of the entry for diagnostics; false if the host is not cached
+  bool entry(const char* host, DnsEntry& out);
+
+ private:
+  static void taskEntry(void* arg);
+  void resolvePending();
+  DnsEntry* find(const char* host);
+  DnsEntry* add(const char* host);
+  bool due(const DnsEntry& e, uint32_t now) const;
+
+  DnsEntry entries_[DNS_CACHE_SIZE];
+  SemaphoreHandle_t mutex_;
+  StaticSemaphore_t mutexBuffer_;
+  TaskHandle_t task_;
+};
+
+extern DnsCache dnsCache;
+
+#endif // DNSCACHE_H
@@ -0,0 +1,113 @@
+#include <string.h>
+#include "effects.h"
+
+static uint16_t rangeEnd(const EffectParams& p, const FrameBuffer& frame) {
+  uint32_t end = (uint32_t)p.start + p.count;
+  return end > frame.size() ? frame.size() : (uint16_t)end;
+}
+
+static uint8_t scale(uint8_t c, uint16_t level) {
+  return (uint8_t)(((uint16_t)c * level) >> 8);
+}
+
+// ---------- fade ----------
+static void fadeBegin(const EffectParams& p, const FrameBuffer& frame, uint8_t* scratch) {
+  uint16_t end = rangeEnd(p, frame);
+  if (p.start < end) {
+    memcpy(scratch + (size_t)p.start * 3, frame.data() + (size_t)p.start * 3, (size_t)(end - p.start) * 3);
+  }
+}
+
+static bool fadeRender(const EffectParams& p, FrameBuffer& frame, const uint8_t* scratch, uint32_t elapsedMs) {
+  uint16_t t = (p.durationMs == 0 || elapsedMs >= p.durationMs) ? 256 : (uint16_t)(((uint64_t)elapsedMs * 256) / p.durationMs);
+  uint16_t end = rangeEnd(p, frame);
+  const uint8_t target[3] = {p.r, p.g, p.b};
+
+  for (uint16_t i = p.start; i < end; i++) {
+    const uint8_t* from = scratch + (size_t)i * 3;
+    uint8_t c[3];
+    for (int k = 0; k < 3; k++) {
+      c[k] = (uint8_t)(from[k] + (((int)target[k] - from[k]) * t) / 256);
+    }
+    frame.setPixel(i, c[0], c[1], c[2]);
+  }
+  return t < 256;
+}
+
+// ---------- breathe ----------
+static bool breatheRender(const EffectParams& p, FrameBuffer& frame, const uint8_t*, uint32_t elapsedMs) {
+  uint32_t period = p.durationMs > 0 ? p.durationMs : 4000;
+  uint32_t phase = (uint32_t)(((uint64_t)(elapsedMs % period) * 512) / period);  // 0..511
+  uint16_t tri = phase < 256 ? phase : 511 - phase;         // 0..255..0
+  uint16_t level = 8 + ((tri * tri) >> 8);                  // eased, never fully dark
+
+  frame.fill(p.start, p.count, scale(p.r, level), scale(p.g, level), scale(p.b, level));
+  return true;
+}
+
+// ---------- chase ----------
+static bool chaseRender(const EffectParams& p, FrameBuffer& frame, const uint8_t*, uint32_t elapsedMs) {
+  uint16_t end = rangeEnd(p, frame);
+  if (p.start >= end) {
+    return false;
+  }
+  uint16_t len = end - p.start;
+  uint16_t width = len / 10 > 0 ? len / 10 : 1;
+  uint32_t period = p.durationMs > 0 ? p.durationMs : 2000;
+  uint16_t head = (uint16_t)(((uint64_t)(elapsedMs % period) * len) / period);
+
+  for (uint16_t i = 0; i < len; i++) {
+    uint16_t behind = (head + len - i) % len;
+    if (behind < width) {
+      frame.setPixel(p.start + i, p.r, p.g, p.b);
+    } else {
+      frame.setPixel(p.start + i, 0, 0, 0);
+    }
+  }
+  return true;
+}
+
+// ---------- rainbow ----------
+static void wheel(uint8_t pos, uint8_t& r, uint8_t& g, uint8_t& b) {
+  if (pos < 85) {
+    r = 255 - pos * 3; g = pos * 3; b = 0;
+  } else if (pos < 170) {
+    pos -= 85;
+    r = 0; g = 255 - pos * 3; b = pos * 3;
+  } else {
+    pos -= 170;
+    r = pos * 3; g = 0; b = 255 - pos * 3;
+  }
+}
+
+static bool rainbowRender(const EffectParams& p, FrameBuffer& frame, const uint8_t*, uint32_t elapsedMs) {
+  uint16_t end = rangeEnd(p, frame);
+  if (p.start >= end) {
+    return false;
+  }
+  uint16_t len = end - p.start;
+  uint32_t period = p.durationMs > 0 ? p.durationMs : 5000;
+  uint8_t offset = (uint8_t)(((uint64_t)(elapsedMs % period) * 256) / period);
+
+  for (uint16_t i = 0; i < len; i++) {
+    uint8_t r, g, b;
+    wheel((uint8_t)((i * 256u) / len + offset), r, g, b);
+    frame.setPixel(p.start + i, r, g, b);
+  }
+  return true;
+}
+
+static const Effect EFFECTS[EFFECT_COUNT] = {
+  {"none", nullptr, nullptr},
+  {"fade", fadeBegin, fadeRender},
+  {"breathe", nullptr, breatheRender},
+  {"chase", nullptr, chaseRender},
+  {"rainbow", nullptr, rainbowRender},
+};
+
+const Effect* getEffect(uint8_t type) {
+  if (type == EFFECT_NONE || type >= EFFECT_COUNT) {
+    return nullptr;
+  }
+  return &EFFECTS[type];
+}
@@ -0,0 +1,37 @@
+#ifndef EFFECTS_H
+#define EFFECTS_H
+
+#include <stdint.h>
+#include "framebuffer.h"
+
+// Frame-based LED effects. Each effect draws one frame for a given time
+// since it started; the render task calls it at a fixed frame rate.
+
+enum EffectType : uint8_t {
+  EFFECT_NONE,
+  EFFECT_FADE,      // cross-fade the range to r/g/b over durationMs
+  EFFECT_BREATHE,   // pulse r/g/b, one breath per durationMs
+  EFFECT_CHASE,     // a block of r/g/b runs along the range every durationMs
+  EFFECT_RAINBOW,   // color wheel scrolling once per durationMs
+  EFFECT_COUNT
+};
+
+struct EffectParams {
+  uint8_t type;
+  uint16_t start;
+  uint16_t count;
+  uint8_t r, g, b;
+  uint32_t durationMs;  // any value; renders scale by it in 64 bits
+};
+
+struct Effect {
+  const char* name;
+  // Optional: called once when the effect starts; scratch holds 3 bytes per pixel
+  void (*begin)(const EffectParams& p, const FrameBuffer& frame, uint8_t* scratch);
+  // Draws the frame at elapsedMs; returns false once the effect has finished
+  bool (*render)(const EffectParams& p, FrameBuffer& frame, const uint8_t* scratch, uint32_t elapsedMs);
+};
+
+const Effect* getEffect(uint8_t type);
+
+#endif // EFFECTS_H
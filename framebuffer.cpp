@@ -0,0 +1,114 @@
+#include <string.h>
+#include "framebuffer.h"
+
+FrameBuffer::FrameBuffer(uint8_t* storage, uint16_t numPixels)
+    : pixels_(storage), numPixels_(numPixels), dirtyStart_(0), dirtyEnd_(0) {
+  memset(pixels_, 0, (size_t)numPixels_ * 3);
+  memset(segments_, 0, sizeof(segments_));
+}
+
+bool FrameBuffer::setPixel(uint16_t index, uint8_t r, uint8_t g, uint8_t b) {
+  if (index >= numPixels_) {
+    return false;
+  }
+  uint8_t* p = pixels_ + (size_t)index * 3;
+  if (p[0] == r && p[1] == g && p[2] == b) {
+    return false;
+  }
+  p[0] = r;
+  p[1] = g;
+  p[2] = b;
+  markDirty(index, index + 1);
+  return true;
+}
+
+void FrameBuffer::getPixel(uint16_t index, uint8_t& r, uint8_t& g, uint8_t& b) const {
+  if (index >= numPixels_) {
+    r = g = b = 0;
+    return;
+  }
+  const uint8_t* p = pixels_ + (size_t)index * 3;
+  r = p[0];
+  g = p[1];
+  b = p[2];
+}
+
+uint16_t FrameBuffer::fill(uint16_t start, uint16_t count, uint8_t r, uint8_t g, uint8_t b) {
+  if (start >= numPixels_) {
+    return 0;
+  }
+  uint16_t end = (count > numPixels_ - start) ? numPixels_ : start + count;
+
+  // Track the changed span locally so an unchanged fill stays clean
+  uint16_t first = end, last = start, changed = 0;
+  uint8_t* p = pixels_ + (size_t)start * 3;
+  for (uint16_t i = start; i < end; i++, p += 3) {
+    if (p[0] != r || p[1] != g || p[2] != b) {
+      p[0] = r;
+      p[1] = g;
+      p[2] = b;
+      if (i < first) {
+        first = i;
+      }
+      last = i;
+      changed++;
+    }
+  }
+  if (changed > 0) {
+    markDirty(first, last + 1);
+  }
+  return changed;
+}
+
+bool FrameBuffer::isBlack() const {
+  for (size_t i = 0; i < (size_t)numPixels_ * 3; i++) {
+    if (pixels_[i] != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void FrameBuffer::markDirty(uint16_t start, uint16_t end) {
+  if (end > numPixels_) {
+    end = numPixels_;
+  }
+  if (start >= end) {
+    return;
+  }
+  if (!isDirty()) {
+    dirtyStart_ = start;
+    dirtyEnd_ = end;
+    return;
+  }
+  if (start < dirtyStart_) {
+    dirtyStart_ = start;
+  }
+  if (end > dirtyEnd_) {
+    dirtyEnd_ = end;
+  }
+}
+
+void FrameBuffer::clearDirty() {
+  dirtyStart_ = 0;
+  dirtyEnd_ = 0;
+}
+
+bool FrameBuffer::defineSegment(uint8_t id, uint16_t start, uint16_t count) {
+  if (id >= MAX_SEGMENTS || start >= numPixels_) {
+    return false;
+  }
+  if (count > numPixels_ - start) {
+    count = numPixels_ - start;
+  }
+  segments_[id].start = start;
+  segments_[id].count = count;
+  return true;
+}
+
+const Segment* FrameBuffer::segment(uint8_t id) const {
+  if (id >= MAX_SEGMENTS || segments_[id].count == 0) {
+    return nullptr;
+  }
+  return &segments_[id];
+}
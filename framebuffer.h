@@ -0,0 +1,50 @@
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// RGB pixel store for the whole strip with dirty-range tracking.
+// Writes that do not change a pixel leave the frame clean, so the output
+// stage only runs (and only touches the changed span) when needed.
+
+struct Segment {
+  uint16_t start;
+  uint16_t count;
+};
+
+class FrameBuffer {
+ public:
+  static const uint8_t MAX_SEGMENTS = 16;
+
+  FrameBuffer(uint8_t* storage, uint16_t numPixels);
+
+  uint16_t size() const { return numPixels_; }
+  const uint8_t* data() const { return pixels_; }
+
+  bool setPixel(uint16_t index, uint8_t r, uint8_t g, uint8_t b);
+  void getPixel(uint16_t index, uint8_t& r, uint8_t& g, uint8_t& b) const;
+  // Clipped to the strip; returns the number of pixels that changed
+  uint16_t fill(uint16_t start, uint16_t count, uint8_t r, uint8_t g, uint8_t b);
+  bool isBlack() const;
+
+  // Dirty span is [dirtyStart, dirtyEnd)
+  bool isDirty() const { return dirtyStart_ < dirtyEnd_; }
+  uint16_t dirtyStart() const { return dirtyStart_; }
+  uint16_t dirtyEnd() const { return dirtyEnd_; }
+  void markDirty(uint16_t start, uint16_t end);
+  void markAllDirty() { markDirty(0, numPixels_); }
+  void clearDirty();
+
+  bool defineSegment(uint8_t id, uint16_t start, uint16_t count);
+  const Segment* segment(uint8_t id) const;
+
+ private:
+  uint8_t* pixels_;
+  uint16_t numPixels_;
+  uint16_t dirtyStart_;
+  uint16_t dirtyEnd_;
+  Segment segments_[MAX_SEGMENTS];
+};
+
+#endif // FRAMEBUFFER_H
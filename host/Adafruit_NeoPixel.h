@@ -0,0 +1,38 @@
+#ifndef ADAFRUIT_NEOPIXEL_H
+#define ADAFRUIT_NEOPIXEL_H
+
+#include <Arduino.h>
+
+#define NEO_GRB 0x52
+#define NEO_KHZ800 0x0000
+
+// Pixels are kept in memory; show() only counts frames
+class Adafruit_NeoPixel {
+ public:
+  Adafruit_NeoPixel(uint16_t n, int16_t pin, uint16_t type) : pixels_((uint8_t*)calloc(n * 3, 1)), numPixels_(n) {}
+
+  void begin() {}
+  void show() { frames++; }
+  bool canShow() { return true; }
+  void clear() { memset(pixels_, 0, numPixels_ * 3); }
+  void setBrightness(uint8_t b) {}
+  void setPixelColor(uint16_t i, uint8_t r, uint8_t g, uint8_t b) {
+    if (i < numPixels_) {
+      pixels_[i * 3] = g;
+      pixels_[i * 3 + 1] = r;
+      pixels_[i * 3 + 2] = b;
+    }
+  }
+  void setPixelColor(uint16_t i, uint32_t c) { setPixelColor(i, c >> 16, c >> 8, c); }
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) { return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b; }
+  uint8_t* getPixels() const { return pixels_; }
+  uint16_t numPixels() const { return numPixels_; }
+
+  uint32_t frames = 0;  // host only
+
+ private:
+  uint8_t* pixels_;
+  uint16_t numPixels_;
+};
+
+#endif // ADAFRUIT_NEOPIXEL_H
@@ -0,0 +1,182 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// Host stand-in for the parts of the ESP32 Arduino core the firmware uses
+// (env:native in platformio.ini). Only enough to build and drive the
+// firmware logic off-device: pins read back as idle, the clock is the
+// host's, and Serial goes to stdout.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define PGM_P const char*
+#define IRAM_ATTR
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define DEC 10
+#define HEX 16
+
+// esp32-hal-log; the firmware's own log.h is what matters on the host
+#define log_e(...) do { if (0) fprintf(stderr, __VA_ARGS__); } while (0)
+#define log_w(...) do { if (0) fprintf(stderr, __VA_ARGS__); } while (0)
+#define log_i(...) do { if (0) fprintf(stderr, __VA_ARGS__); } while (0)
+#define log_d(...) do { if (0) fprintf(stderr, __VA_ARGS__); } while (0)
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+inline void delayMicroseconds(unsigned int us) {}
+inline void yield() {}
+
+inline void pinMode(int pin, int mode) {}
+inline void digitalWrite(int pin, int value) {}
+inline int digitalRead(int pin) { return HIGH; }
+
+inline long random(long max) { return max > 0 ? rand() % max : 0; }
+inline long random(long min, long max) { return max > min ? min + rand() % (max - min) : min; }
+inline uint32_t esp_random() { return ((uint32_t)rand() << 16) ^ (uint32_t)rand(); }
+
+// Arduino String on top of std::string; allocation behaviour differs from
+// the ESP32 one only in the size of the inline buffer
+class String {
+ public:
+  String() {}
+  String(const char* s) : s_(s != nullptr ? s : "") {}
+  String(const std::string& s) : s_(s) {}
+  String(char c) : s_(1, c) {}
+  String(int v, int base = 10) { format(base == HEX ? "%x" : "%d", v); }
+  String(unsigned int v, int base = 10) { format(base == HEX ? "%x" : "%u", v); }
+  String(long v, int base = 10) { format(base == HEX ? "%lx" : "%ld", v); }
+  String(unsigned long v, int base = 10) { format(base == HEX ? "%lx" : "%lu", v); }
+
+  const char* c_str() const { return s_.c_str(); }
+  unsigned int length() const { return s_.size(); }
+  bool isEmpty() const { return s_.empty(); }
+  char operator[](unsigned int i) const { return s_[i]; }
+
+  bool operator==(const String& o) const { return s_ == o.s_; }
+  bool operator==(const char* o) const { return s_ == o; }
+  bool operator!=(const String& o) const { return s_ != o.s_; }
+  String& operator+=(const String& o) { s_ += o.s_; return *this; }
+  String& operator+=(const char* o) { s_ += o; return *this; }
+  String& operator+=(char c) { s_ += c; return *this; }
+  friend String operator+(const String& a, const String& b) { return String(a.s_ + b.s_); }
+  friend String operator+(const String& a, const char* b) { return String(a.s_ + b); }
+  friend String operator+(const char* a, const String& b) { return String(a + b.s_); }
+
+  int indexOf(char c, unsigned int from = 0) const { return position(s_.find(c, from)); }
+  int indexOf(const char* s, unsigned int from = 0) const { return position(s_.find(s, from)); }
+  String substring(unsigned int from) const { return from < s_.size() ? String(s_.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const {
+    return from < s_.size() && to > from ? String(s_.substr(from, to - from)) : String();
+  }
+  bool startsWith(const char* prefix) const { return s_.compare(0, strlen(prefix), prefix) == 0; }
+  long toInt() const { return atol(s_.c_str()); }
+  void trim() {
+    size_t a = s_.find_first_not_of(" \t\r\n");
+    size_t b = s_.find_last_not_of(" \t\r\n");
+    s_ = a == std::string::npos ? std::string() : s_.substr(a, b - a + 1);
+  }
+
+ private:
+  template <typename T>
+  void format(const char* fmt, T v) {
+    char buf[24];
+    snprintf(buf, sizeof(buf), fmt, v);
+    s_ = buf;
+  }
+  static int position(size_t p) { return p == std::string::npos ? -1 : (int)p; }
+
+  std::string s_;
+};
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buf, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+      write(buf[i]);
+    }
+    return n;
+  }
+  size_t write(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+
+  size_t print(const char* s) { return write(s); }
+  size_t print(const String& s) { return write(s.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v) { return print(String(v)); }
+  size_t print(unsigned int v) { return print(String(v)); }
+  size_t print(long v) { return print(String(v)); }
+  size_t print(unsigned long v) { return print(String(v)); }
+  template <typename T>
+  size_t println(const T& v) { return print(v) + println(); }
+  size_t println() { return write("\r\n"); }
+
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[256];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n < 0) {
+      return 0;
+    }
+    return write((const uint8_t*)buf, (size_t)n < sizeof(buf) ? n : sizeof(buf) - 1);
+  }
+};
+
+class Stream : public Print {
+ public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+};
+
+class HardwareSerial : public Stream {
+ public:
+  void begin(unsigned long baud) {}
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buf, size_t n) override { return quiet ? n : fwrite(buf, 1, n, stdout); }
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  void flush() { fflush(stdout); }
+  int availableForWrite() { return 128; }
+
+  bool quiet = false;  // host only: drop output, e.g. while benchmarking
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+ public:
+  void restart();
+  uint32_t getFreeHeap() { return 200000; }
+  uint32_t getMinFreeHeap() { return 150000; }
+  uint32_t getMaxAllocHeap() { return 100000; }
+  const char* getChipModel() { return "host"; }
+  uint8_t getChipCores() { return 2; }
+  uint32_t getFlashChipSize() { return 8u << 20; }
+};
+
+extern EspClass ESP;
+
+#endif // ARDUINO_H
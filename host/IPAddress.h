@@ -0,0 +1,40 @@
+#ifndef IPADDRESS_H
+#define IPADDRESS_H
+
+#include <Arduino.h>
+
+class IPAddress {
+ public:
+  IPAddress() : bytes_{0, 0, 0, 0} {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : bytes_{a, b, c, d} {}
+  IPAddress(uint32_t v) { memcpy(bytes_, &v, 4); }
+
+  operator uint32_t() const {
+    uint32_t v;
+    memcpy(&v, bytes_, 4);
+    return v;
+  }
+  uint8_t operator[](int i) const { return bytes_[i]; }
+  uint8_t& operator[](int i) { return bytes_[i]; }
+
+  bool fromString(const char* s) {
+    unsigned a, b, c, d;
+    char tail;
+    if (sscanf(s, "%u.%u.%u.%u%c", &a, &b, &c, &d, &tail) != 4 || a > 255 || b > 255 || c > 255 || d > 255) {
+      return false;
+    }
+    *this = IPAddress(a, b, c, d);
+    return true;
+  }
+
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", bytes_[0], bytes_[1], bytes_[2], bytes_[3]);
+    return String(buf);
+  }
+
+ private:
+  uint8_t bytes_[4];
+};
+
+#endif // IPADDRESS_H
@@ -0,0 +1,73 @@
+#ifndef LITTLEFS_H
+#define LITTLEFS_H
+
+#include <Arduino.h>
+#include <memory>
+
+// LittleFS on top of stdio, rooted at $LITTLEFS_ROOT (default /tmp)
+namespace fs {
+
+enum SeekMode { SeekSet = SEEK_SET, SeekCur = SEEK_CUR, SeekEnd = SEEK_END };
+
+class File {
+ public:
+  File() {}
+  explicit File(FILE* f) : f_(f, fclose) {}
+
+  size_t write(const uint8_t* buf, size_t n) { return f_ ? fwrite(buf, 1, n, f_.get()) : 0; }
+  size_t read(uint8_t* buf, size_t n) { return f_ ? fread(buf, 1, n, f_.get()) : 0; }
+  bool seek(uint32_t pos, SeekMode mode = SeekSet) { return f_ && fseek(f_.get(), pos, mode) == 0; }
+  size_t position() const { return f_ ? ftell(f_.get()) : 0; }
+  size_t size() const {
+    if (!f_) {
+      return 0;
+    }
+    long pos = ftell(f_.get());
+    fseek(f_.get(), 0, SEEK_END);
+    long end = ftell(f_.get());
+    fseek(f_.get(), pos, SEEK_SET);
+    return end;
+  }
+  void flush() {
+    if (f_) {
+      fflush(f_.get());
+    }
+  }
+  void close() { f_.reset(); }
+  operator bool() const { return (bool)f_; }
+
+ private:
+  std::shared_ptr<FILE> f_;
+};
+
+class LittleFSFS {
+ public:
+  bool begin(bool formatOnFail = false) { return true; }
+  File open(const char* path, const char* mode = "r") {
+    FILE* f = fopen(hostPath(path).c_str(), mode);
+    return f != nullptr ? File(f) : File();
+  }
+  bool exists(const char* path) {
+    FILE* f = fopen(hostPath(path).c_str(), "r");
+    if (f != nullptr) {
+      fclose(f);
+    }
+    return f != nullptr;
+  }
+  bool remove(const char* path) { return ::remove(hostPath(path).c_str()) == 0; }
+  size_t totalBytes() { return 1536 * 1024; }
+  size_t usedBytes() { return 0; }
+
+ private:
+  static std::string hostPath(const char* path) {
+    const char* root = getenv("LITTLEFS_ROOT");
+    return std::string(root != nullptr ? root : "/tmp") + path;
+  }
+};
+
+}  // namespace fs
+
+using fs::File;
+extern fs::LittleFSFS LittleFS;
+
+#endif // LITTLEFS_H
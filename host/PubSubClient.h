@@ -0,0 +1,76 @@
+#ifndef PUBSUBCLIENT_H
+#define PUBSUBCLIENT_H
+
+#include <Arduino.h>
+#include <Client.h>
+#include <IPAddress.h>
+#include <functional>
+
+#define MQTT_CALLBACK_SIGNATURE std::function<void(char*, uint8_t*, unsigned int)> callback
+
+// Connects at once and swallows publishes, counting them. deliver() plays
+// the part of an incoming message: it goes to the callback from a buffer
+// owned by the client, as with the real library.
+class PubSubClient {
+ public:
+  PubSubClient(Client& client) {}
+
+  PubSubClient& setServer(const char* host, uint16_t port) { return *this; }
+  PubSubClient& setServer(IPAddress ip, uint16_t port) { return *this; }
+  PubSubClient& setCallback(MQTT_CALLBACK_SIGNATURE) {
+    callback_ = callback;
+    return *this;
+  }
+  PubSubClient& setKeepAlive(uint16_t seconds) { return *this; }
+  PubSubClient& setSocketTimeout(uint16_t seconds) { return *this; }
+  bool setBufferSize(uint16_t size) {
+    bufferSize_ = size;
+    return true;
+  }
+
+  bool connect(const char* id) { return connected_ = true; }
+  bool connect(const char* id, const char* user, const char* pass) { return connected_ = true; }
+  void disconnect() { connected_ = false; }
+  bool connected() { return connected_; }
+  int state() { return connected_ ? 0 : -1; }
+  bool loop() { return connected_; }
+
+  bool publish(const char* topic, const char* payload) { return publish(topic, payload, false); }
+  bool publish(const char* topic, const char* payload, bool retained) {
+    return publish(topic, (const uint8_t*)payload, strlen(payload), retained);
+  }
+  bool publish(const char* topic, const uint8_t* payload, unsigned int length) {
+    return publish(topic, payload, length, false);
+  }
+  bool publish(const char* topic, const uint8_t* payload, unsigned int length, bool retained) {
+    if (!connected_) {
+      return false;
+    }
+    published++;
+    publishedBytes += length;
+    return true;
+  }
+  bool subscribe(const char* topic) { return connected_; }
+
+  // Host only
+  bool deliver(const char* topic, const uint8_t* payload, unsigned int length) {
+    size_t topicLength = strlen(topic);
+    if (!callback_ || topicLength + 1 + length > bufferSize_) {
+      return false;
+    }
+    memcpy(buffer_, topic, topicLength + 1);
+    memcpy(buffer_ + topicLength + 1, payload, length);
+    callback_(buffer_, (uint8_t*)buffer_ + topicLength + 1, length);
+    return true;
+  }
+  uint32_t published = 0;
+  uint32_t publishedBytes = 0;
+
+ private:
+  std::function<void(char*, uint8_t*, unsigned int)> callback_;
+  char buffer_[4096];
+  uint16_t bufferSize_ = 256;
+  bool connected_ = false;
+};
+
+#endif // PUBSUBCLIENT_H
@@ -0,0 +1,40 @@
+#ifndef WIFI_H
+#define WIFI_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#include <WiFiClient.h>
+#include <WiFiServer.h>
+
+#define WIFI_STA 1
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+// Always associated, on loopback
+class WiFiClass {
+ public:
+  void mode(int m) {}
+  void begin(const char* ssid, const char* password) {}
+  wl_status_t status() { return WL_CONNECTED; }
+  IPAddress localIP() { return IPAddress(127, 0, 0, 1); }
+  IPAddress subnetMask() { return IPAddress(255, 0, 0, 0); }
+  IPAddress gatewayIP() { return IPAddress(127, 0, 0, 1); }
+  IPAddress dnsIP() { return IPAddress(127, 0, 0, 1); }
+  String macAddress() { return "02:00:00:00:00:01"; }
+  int8_t RSSI() { return -50; }
+  uint8_t channel() { return 1; }
+  int hostByName(const char* host, IPAddress& ip) { return ip.fromString(host) || ip.fromString("127.0.0.1"); }
+  bool setAutoReconnect(bool on) { return true; }
+  bool reconnect() { return true; }
+  bool disconnect(bool wifiOff = false) { return true; }
+};
+
+extern WiFiClass WiFi;
+
+#endif // WIFI_H
@@ -0,0 +1,82 @@
+#ifndef WIFICLIENT_H
+#define WIFICLIENT_H
+
+#include <Client.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <memory>
+
+// Socket-backed client. Copies share the socket, as on the ESP32. There is
+// no outbound network on the host, so connect() always fails; connected
+// sockets come from WiFiServer::hostConnect().
+class WiFiClient : public Client {
+ public:
+  WiFiClient() {}
+  // Host only: wraps a connected, non-blocking socket and takes ownership
+  explicit WiFiClient(int fd) : socket_(std::make_shared<Socket>(fd)) {}
+
+  int connect(IPAddress ip, uint16_t port) override { return 0; }
+  int connect(const char* host, uint16_t port) override { return 0; }
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buf, size_t n) override {
+    size_t done = 0;
+    while (socket_ && done < n) {
+      ssize_t r = ::send(socket_->fd, buf + done, n - done, MSG_NOSIGNAL);
+      if (r < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+        break;
+      }
+      done += r > 0 ? r : 0;
+    }
+    return done;
+  }
+  using Print::write;
+
+  int available() override {
+    int n = 0;
+    return socket_ && ioctl(socket_->fd, FIONREAD, &n) == 0 ? n : 0;
+  }
+  int read() override {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+  }
+  int read(uint8_t* buf, size_t n) override { return socket_ ? ::recv(socket_->fd, buf, n, MSG_DONTWAIT) : -1; }
+  int peek() override { return -1; }
+  void flush() override {}
+
+  void stop() override {
+    if (socket_) {
+      ::shutdown(socket_->fd, SHUT_RDWR);
+    }
+    socket_.reset();
+  }
+  uint8_t connected() override {
+    if (!socket_) {
+      return 0;
+    }
+    char c;
+    ssize_t r = ::recv(socket_->fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    return r > 0 || (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK));
+  }
+  operator bool() override { return (bool)socket_; }
+
+  void setTimeout(unsigned long ms) {}
+  int setNoDelay(bool on) { return 0; }
+  IPAddress remoteIP() const { return socket_ ? IPAddress(127, 0, 0, 1) : IPAddress(); }
+  int fd() const { return socket_ ? socket_->fd : -1; }
+  bool operator==(const WiFiClient& o) const { return socket_ == o.socket_; }
+
+ private:
+  struct Socket {
+    explicit Socket(int f) : fd(f) {}
+    ~Socket() { ::close(fd); }
+    int fd;
+  };
+
+  std::shared_ptr<Socket> socket_;
+};
+
+#endif // WIFICLIENT_H
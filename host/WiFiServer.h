@@ -0,0 +1,75 @@
+#ifndef WIFISERVER_H
+#define WIFISERVER_H
+
+#include <WiFiClient.h>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+// Listens on in-process connections only: hostConnect() hands the server
+// one end of a socket pair and the caller the other
+class WiFiServer {
+ public:
+  WiFiServer(uint16_t port = 80) : port_(port) {}
+
+  void begin() {
+    std::lock_guard<std::mutex> guard(lock());
+    listening().push_back(port_);
+  }
+  void setNoDelay(bool on) {}
+
+  WiFiClient available() {
+    std::lock_guard<std::mutex> guard(lock());
+    for (auto it = pending().begin(); it != pending().end(); ++it) {
+      if (it->first == port_) {
+        int fd = it->second;
+        pending().erase(it);
+        return WiFiClient(fd);
+      }
+    }
+    return WiFiClient();
+  }
+  WiFiClient accept() { return available(); }
+
+  // Host only: whether begin() was called for port
+  static bool hostListening(uint16_t port) {
+    std::lock_guard<std::mutex> guard(lock());
+    for (uint16_t p : listening()) {
+      if (p == port) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Host only: returns the client side of a new connection to port, -1 on
+  // failure. The caller closes it.
+  static int hostConnect(uint16_t port) {
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+      return -1;
+    }
+    fcntl(fds[1], F_SETFL, O_NONBLOCK);
+    std::lock_guard<std::mutex> guard(lock());
+    pending().push_back(std::make_pair(port, fds[1]));
+    return fds[0];
+  }
+
+ private:
+  static std::deque<std::pair<uint16_t, int>>& pending() {
+    static std::deque<std::pair<uint16_t, int>> connections;
+    return connections;
+  }
+  static std::deque<uint16_t>& listening() {
+    static std::deque<uint16_t> ports;
+    return ports;
+  }
+  static std::mutex& lock() {
+    static std::mutex m;
+    return m;
+  }
+
+  uint16_t port_;
+};
+
+#endif // WIFISERVER_H
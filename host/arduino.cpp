@@ -0,0 +1,73 @@
+// Globals and timing behind the host fakes (env:native)
+#include <Arduino.h>
+#include <ESPmDNS.h>
+#include <LittleFS.h>
+#include <WiFi.h>
+#include <driver/rmt.h>
+#include <esp_sntp.h>
+#include <esp_timer.h>
+#include <chrono>
+#include <thread>
+
+HardwareSerial Serial;
+EspClass ESP;
+WiFiClass WiFi;
+MDNSResponder MDNS;
+fs::LittleFSFS LittleFS;
+
+static const auto bootTime = std::chrono::steady_clock::now();
+
+static uint64_t elapsedUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - bootTime).count();
+}
+
+unsigned long millis() {
+  return elapsedUs() / 1000;
+}
+
+unsigned long micros() {
+  return elapsedUs();
+}
+
+void delay(unsigned long ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+int64_t esp_timer_get_time() {
+  return elapsedUs();
+}
+
+void EspClass::restart() {
+  fflush(stdout);
+  exit(0);
+}
+
+// ========================================
+// SNTP
+// ========================================
+static sntp_sync_time_cb_t sntpCallback = nullptr;
+
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback) {
+  sntpCallback = callback;
+}
+
+void sntp_set_sync_interval(uint32_t intervalMs) {}
+
+void configTime(long gmtOffsetSec, int daylightOffsetSec, const char* server1, const char* server2,
+                const char* server3) {
+  if (sntpCallback != nullptr) {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    sntpCallback(&tv);
+  }
+}
+
+// ========================================
+// RMT
+// ========================================
+esp_err_t rmt_config(const rmt_config_t* config) { return ESP_OK; }
+esp_err_t rmt_driver_install(rmt_channel_t channel, size_t rxBufferSize, int flags) { return ESP_OK; }
+esp_err_t rmt_driver_uninstall(rmt_channel_t channel) { return ESP_OK; }
+esp_err_t rmt_translator_init(rmt_channel_t channel, sample_to_rmt_t fn) { return ESP_OK; }
+esp_err_t rmt_write_sample(rmt_channel_t channel, const uint8_t* src, size_t size, bool waitDone) { return ESP_OK; }
+esp_err_t rmt_wait_tx_done(rmt_channel_t channel, TickType_t wait) { return ESP_OK; }
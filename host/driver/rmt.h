@@ -0,0 +1,36 @@
+#ifndef DRIVER_RMT_H
+#define DRIVER_RMT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <freertos/FreeRTOS.h>
+
+// RMT transmit API as used by ws2812driver.cpp; writes complete at once
+typedef int esp_err_t;
+#define ESP_OK 0
+
+typedef int gpio_num_t;
+typedef enum { RMT_CHANNEL_0 } rmt_channel_t;
+typedef struct {
+  uint32_t val;
+} rmt_item32_t;
+typedef struct {
+  int channel;
+  int gpio_num;
+  uint8_t clk_div;
+  uint8_t mem_block_num;
+} rmt_config_t;
+#define RMT_DEFAULT_CONFIG_TX(gpio, channel_id) \
+  rmt_config_t { channel_id, gpio, 80, 1 }
+
+typedef void (*sample_to_rmt_t)(const void* src, rmt_item32_t* dest, size_t srcSize, size_t wantedNum,
+                                size_t* translatedSize, size_t* itemNum);
+
+esp_err_t rmt_config(const rmt_config_t* config);
+esp_err_t rmt_driver_install(rmt_channel_t channel, size_t rxBufferSize, int flags);
+esp_err_t rmt_driver_uninstall(rmt_channel_t channel);
+esp_err_t rmt_translator_init(rmt_channel_t channel, sample_to_rmt_t fn);
+esp_err_t rmt_write_sample(rmt_channel_t channel, const uint8_t* src, size_t size, bool waitDone);
+esp_err_t rmt_wait_tx_done(rmt_channel_t channel, TickType_t wait);
+
+#endif // DRIVER_RMT_H
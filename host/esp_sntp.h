@@ -0,0 +1,16 @@
+#ifndef ESP_SNTP_H
+#define ESP_SNTP_H
+
+#include <stdint.h>
+#include <sys/time.h>
+
+// The host clock is already NTP-disciplined: configTime() reports a sync
+// straight away and leaves the clock alone
+typedef void (*sntp_sync_time_cb_t)(struct timeval* tv);
+
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback);
+void sntp_set_sync_interval(uint32_t intervalMs);
+void configTime(long gmtOffsetSec, int daylightOffsetSec, const char* server1, const char* server2 = nullptr,
+                const char* server3 = nullptr);
+
+#endif // ESP_SNTP_H
@@ -0,0 +1,112 @@
+// FreeRTOS tasks, notifications and mutexes on std::thread. Priorities and
+// core affinity are ignored. Task state is never freed, so tasks still
+// blocked at exit do not touch destroyed objects.
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <Arduino.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+struct HostTask {
+  std::mutex lock;
+  std::condition_variable wake;
+  uint32_t notifications = 0;
+};
+
+static thread_local HostTask* currentTask = nullptr;
+
+static HostTask* selfTask() {
+  if (currentTask == nullptr) {
+    currentTask = new HostTask();  // loop() thread, or a foreign thread
+  }
+  return currentTask;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack, void* arg,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t core) {
+  HostTask* task = new HostTask();
+  if (handle != nullptr) {
+    *handle = task;
+  }
+  std::thread([fn, arg, task]() {
+    currentTask = task;
+    fn(arg);
+  }).detach();
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack, void* arg, UBaseType_t priority,
+                       TaskHandle_t* handle) {
+  return xTaskCreatePinnedToCore(fn, name, stack, arg, priority, handle, 0);
+}
+
+void vTaskDelay(TickType_t ticks) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+void vTaskDelayUntil(TickType_t* previousWake, TickType_t increment) {
+  *previousWake += increment;
+  int32_t wait = (int32_t)(*previousWake - xTaskGetTickCount());
+  if (wait > 0) {
+    vTaskDelay(wait);
+  }
+}
+
+TickType_t xTaskGetTickCount() {
+  return millis();
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t wait) {
+  HostTask* task = selfTask();
+  std::unique_lock<std::mutex> guard(task->lock);
+  auto pending = [task]() { return task->notifications > 0; };
+  if (wait == portMAX_DELAY) {
+    task->wake.wait(guard, pending);
+  } else {
+    task->wake.wait_for(guard, std::chrono::milliseconds(wait), pending);
+  }
+  uint32_t value = task->notifications;
+  if (value > 0) {
+    task->notifications = clearOnExit ? 0 : value - 1;
+  }
+  return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t handle) {
+  HostTask* task = (HostTask*)handle;
+  if (task == nullptr) {
+    return pdFAIL;
+  }
+  {
+    std::lock_guard<std::mutex> guard(task->lock);
+    task->notifications++;
+  }
+  task->wake.notify_one();
+  return pdPASS;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t* buffer) {
+  buffer->mutex = new std::timed_mutex();
+  return buffer->mutex;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  return new std::timed_mutex();
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t wait) {
+  std::timed_mutex* mutex = (std::timed_mutex*)semaphore;
+  if (wait == portMAX_DELAY) {
+    mutex->lock();
+    return pdTRUE;
+  }
+  return mutex->try_lock_for(std::chrono::milliseconds(wait)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+  ((std::timed_mutex*)semaphore)->unlock();
+  return pdTRUE;
+}
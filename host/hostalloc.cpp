@@ -0,0 +1,89 @@
+#include "hostalloc.h"
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+}
+
+// Plain POD thread locals: no constructor, so no allocation to set them up
+static __thread HostAllocStats counters;
+
+static void countAlloc(void* p) {
+  if (p == nullptr) {
+    return;
+  }
+  size_t size = malloc_usable_size(p);
+  counters.allocations++;
+  counters.bytes += size;
+  counters.liveBytes += size;
+  if (counters.liveBytes > counters.peakBytes) {
+    counters.peakBytes = counters.liveBytes;
+  }
+}
+
+static void countFree(void* p) {
+  if (p == nullptr) {
+    return;
+  }
+  counters.frees++;
+  counters.liveBytes -= malloc_usable_size(p);
+}
+
+extern "C" {
+
+void* malloc(size_t size) {
+  void* p = __libc_malloc(size);
+  countAlloc(p);
+  return p;
+}
+
+void* calloc(size_t count, size_t size) {
+  void* p = __libc_calloc(count, size);
+  countAlloc(p);
+  return p;
+}
+
+void* realloc(void* ptr, size_t size) {
+  countFree(ptr);
+  void* p = __libc_realloc(ptr, size);
+  countAlloc(p != nullptr ? p : (size == 0 ? nullptr : ptr));
+  return p;
+}
+
+void free(void* ptr) {
+  countFree(ptr);
+  __libc_free(ptr);
+}
+
+}  // extern "C"
+
+bool hostAllocSupported() {
+  return true;
+}
+
+HostAllocStats hostAllocStats() {
+  return counters;
+}
+
+void hostAllocReset() {
+  counters = HostAllocStats();
+}
+
+#else
+
+bool hostAllocSupported() {
+  return false;
+}
+
+HostAllocStats hostAllocStats() {
+  return HostAllocStats();
+}
+
+void hostAllocReset() {}
+
+#endif
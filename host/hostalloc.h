@@ -0,0 +1,25 @@
+#ifndef HOSTALLOC_H
+#define HOSTALLOC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Heap accounting for host benchmarks. malloc/calloc/realloc (and through
+// them operator new) are counted per thread, so a benchmark sees only its
+// own allocations, not those of the render or log tasks. Needs glibc;
+// elsewhere hostAllocSupported() is false and the counters stay at zero.
+
+struct HostAllocStats {
+  uint64_t allocations;
+  uint64_t frees;
+  uint64_t bytes;      // total requested
+  int64_t liveBytes;   // requested minus freed
+  int64_t peakBytes;   // highest liveBytes since the last reset
+};
+
+bool hostAllocSupported();
+HostAllocStats hostAllocStats();
+// Zeroes the counters and starts a new peak window for this thread
+void hostAllocReset();
+
+#endif // HOSTALLOC_H
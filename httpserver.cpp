@@ -0,0 +1,689 @@
+#include <Arduino.h>
+#include <errno.h>
+#include <lwip/sockets.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include "httpserver.h"
+#include "log.h"
+
+static const char* statusText(int code) {
+  switch (code) {
+    case 200: return "OK";
+    case 204: return "No Content";
+    case 302: return "Found";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 401: return "Unauthorized";
+    case 403: return "Forbidden";
+    case 404: return "Not Found";
+    case 408: return "Request Timeout";
+    case 413: return "Payload Too Large";
+    case 431: return "Request Header Fields Too Large";
+    case 500: return "Internal Server Error";
+    case 503: return "Service Unavailable";
+    default: return "";
+  }
+}
+
+static HTTPMethod parseMethod(const char* s) {
+  if (strcmp(s, "GET") == 0) return HTTP_GET;
+  if (strcmp(s, "POST") == 0) return HTTP_POST;
+  if (strcmp(s, "HEAD") == 0) return HTTP_HEAD;
+  if (strcmp(s, "PUT") == 0) return HTTP_PUT;
+  if (strcmp(s, "PATCH") == 0) return HTTP_PATCH;
+  if (strcmp(s, "DELETE") == 0) return HTTP_DELETE;
+  if (strcmp(s, "OPTIONS") == 0) return HTTP_OPTIONS;
+  return HTTP_ANY;
+}
+
+static int hexDigit(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// Decodes %XX and '+' in place
+static void urlDecode(char* s) {
+  char* out = s;
+  for (; *s != '\0'; s++) {
+    if (*s == '+') {
+      *out++ = ' ';
+    } else if (*s == '%' && hexDigit(s[1]) >= 0 && hexDigit(s[2]) >= 0) {
+      *out++ = (char)((hexDigit(s[1]) << 4) | hexDigit(s[2]));
+      s += 2;
+    } else {
+      *out++ = *s;
+    }
+  }
+  *out = '\0';
+}
+
+HttpServer::HttpServer(uint16_t port)
+    : listener_(port), routeCount_(0), notFound_(nullptr), middleware_(nullptr), current_(nullptr), method_(HTTP_ANY), path_(nullptr),
+      headerCount_(0), argCount_(0), pathArgCount_(0), extraLen_(0), contentLength_(0), headSent_(false), chunked_(false),
+      detached_(false), failed_(false) {
+  for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+    conns_[i].state = CONN_FREE;
+  }
+}
+
+void HttpServer::begin() {
+  listener_.begin();
+  listener_.setNoDelay(true);
+}
+
+void HttpServer::on(const char* uri, HTTPMethod method, Handler handler, uint8_t tag) {
+  if (routeCount_ >= MAX_ROUTES) {
+    LOG_E("HTTP", "✗ Route table full, %s not registered", uri);
+    return;
+  }
+  routes_[routeCount_++] = {uri, method, tag, handler};
+}
+
+uint8_t HttpServer::activeConnections() const {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+    if (conns_[i].state != CONN_FREE) {
+      n++;
+    }
+  }
+  return n;
+}
+
+// ========================================
+// Connection handling
+// ========================================
+void HttpServer::handleClient() {
+  accept();
+
+  unsigned long now = millis();
+  for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+    Connection& c = conns_[i];
+    if (c.state == CONN_FREE) {
+      continue;
+    }
+
+    if (c.state == CONN_WRITING) {
+      if (drain(c)) {
+        finishResponse(c);
+      } else if (c.state != CONN_FREE && now - c.lastActivity > HTTP_WRITE_TIMEOUT_MS) {
+        LOG_D("HTTP", "Write stalled, dropping connection");
+        close(c);
+      }
+      continue;
+    }
+
+    readFrom(c);
+    if (c.state == CONN_FREE) {
+      continue;
+    }
+
+    size_t headerLen, totalLen;
+    if (requestComplete(c, headerLen, totalLen)) {
+      process(c, headerLen, totalLen);
+    } else if (c.state == CONN_READING && now - c.lastActivity > (c.inLen > 0 ? HTTP_REQUEST_TIMEOUT_MS : HTTP_KEEPALIVE_TIMEOUT_MS)) {
+      close(c);
+    }
+  }
+}
+
+void HttpServer::accept() {
+  for (;;) {
+    WiFiClient client = listener_.available();
+    if (!client) {
+      return;
+    }
+    Connection* slot = nullptr;
+    for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+      if (conns_[i].state == CONN_FREE) {
+        slot = &conns_[i];
+        break;
+      }
+    }
+    if (slot == nullptr) {
+      reject(client, 503);
+      continue;
+    }
+    client.setNoDelay(true);
+    slot->client = client;
+    slot->state = CONN_READING;
+    slot->keepAlive = true;
+    slot->requests = 0;
+    slot->inLen = 0;
+    slot->outLen = 0;
+    slot->outSent = 0;
+    slot->body = nullptr;
+    slot->bodyLen = 0;
+    slot->producer = nullptr;
+    slot->lastActivity = millis();
+  }
+}
+
+void HttpServer::reject(WiFiClient& client, int code) {
+  char buf[96];
+  int n = snprintf(buf, sizeof(buf), "HTTP/1.1 %d %s\r\nContent-Length: 0\r\nConnection: close\r\n\r\n", code, statusText(code));
+  ::send(client.fd(), buf, n, MSG_DONTWAIT);
+  client.stop();
+}
+
+void HttpServer::readFrom(Connection& c) {
+  int avail = c.client.available();
+  if (avail <= 0) {
+    if (!c.client.connected()) {
+      close(c);
+    }
+    return;
+  }
+  // One byte stays free so the request can be NUL-terminated in place
+  size_t space = sizeof(c.in) - 1 - c.inLen;
+  if (space == 0) {
+    return;
+  }
+  int n = c.client.read((uint8_t*)c.in + c.inLen, (size_t)avail < space ? avail : space);
+  if (n > 0) {
+    c.inLen += n;
+    c.lastActivity = millis();
+  }
+}
+
+bool HttpServer::requestComplete(Connection& c, size_t& headerLen, size_t& totalLen) {
+  c.in[c.inLen] = '\0';
+  char* end = strstr(c.in, "\r\n\r\n");
+  if (end == nullptr) {
+    if (c.inLen >= sizeof(c.in) - 1) {
+      reject(c.client, 431);
+      c.state = CONN_FREE;
+    }
+    return false;
+  }
+  headerLen = end - c.in + 4;
+
+  // Compared before adding so a huge length cannot wrap the sum
+  unsigned long bodyLen = 0;
+  const char* cl = strcasestr(c.in, "\r\nContent-Length:");
+  if (cl != nullptr && cl < end) {
+    const char* p = cl + 17;
+    p += strspn(p, " \t");
+    char* digitsEnd;
+    bodyLen = strtoul(p, &digitsEnd, 10);
+    if (*p < '0' || *p > '9' || digitsEnd[strspn(digitsEnd, " \t")] != '\r') {
+      reject(c.client, 400);
+      c.state = CONN_FREE;
+      return false;
+    }
+  }
+  if (bodyLen > sizeof(c.in) - 1 - headerLen) {
+    reject(c.client, 413);
+    c.state = CONN_FREE;
+    return false;
+  }
+  totalLen = headerLen + bodyLen;
+  return c.inLen >= totalLen;
+}
+
+void HttpServer::process(Connection& c, size_t headerLen, size_t totalLen) {
+  // Parsing writes NULs into the buffer; keep the first byte of any
+  // pipelined request that follows
+  char next = c.in[totalLen];
+  c.in[totalLen] = '\0';
+
+  c.requests++;
+  current_ = &c;
+  extraLen_ = 0;
+  contentLength_ = 0;
+  headSent_ = false;
+  chunked_ = false;
+  detached_ = false;
+  failed_ = false;
+  c.outLen = 0;
+  c.outSent = 0;
+  c.body = nullptr;
+  c.bodyLen = 0;
+  c.producer = nullptr;
+
+  if (parseRequest(c, headerLen, totalLen)) {
+    dispatch();
+  } else {
+    c.keepAlive = false;
+    send(400, "text/plain", "Bad Request");
+  }
+  current_ = nullptr;
+
+  if (detached_) {
+    // The handler owns the socket now; drop our reference without closing
+    c.client = WiFiClient();
+    c.state = CONN_FREE;
+    return;
+  }
+  if (!headSent_) {
+    LOG_W("HTTP", "No response from handler for %s", path_);
+    c.keepAlive = false;
+    current_ = &c;
+    send(500, "text/plain", "No response");
+    current_ = nullptr;
+  }
+  if (chunked_ && c.producer == nullptr) {
+    current_ = &c;
+    sendContent("", 0);
+    current_ = nullptr;
+  }
+  if (failed_) {
+    close(c);
+    return;
+  }
+
+  c.in[totalLen] = next;
+  memmove(c.in, c.in + totalLen, c.inLen - totalLen);
+  c.inLen -= totalLen;
+
+  c.state = CONN_WRITING;
+  c.lastActivity = millis();
+  if (drain(c)) {
+    finishResponse(c);
+  }
+}
+
+bool HttpServer::parseRequest(Connection& c, size_t headerLen, size_t totalLen) {
+  headerCount_ = 0;
+  argCount_ = 0;
+
+  // Request line: METHOD SP target SP version CRLF
+  char* line = c.in;
+  char* lineEnd = strstr(line, "\r\n");
+  *lineEnd = '\0';
+  char* sp1 = strchr(line, ' ');
+  char* sp2 = sp1 ? strchr(sp1 + 1, ' ') : nullptr;
+  if (sp1 == nullptr || sp2 == nullptr) {
+    path_ = (char*)"";
+    return false;
+  }
+  *sp1 = '\0';
+  *sp2 = '\0';
+  method_ = parseMethod(line);
+  path_ = sp1 + 1;
+  bool http11 = strcmp(sp2 + 1, "HTTP/1.1") == 0;
+
+  char* query = strchr(path_, '?');
+  if (query != nullptr) {
+    *query++ = '\0';
+  }
+  urlDecode(path_);
+
+  // Headers
+  char* p = lineEnd + 2;
+  char* headersEnd = c.in + headerLen - 2;
+  while (p < headersEnd) {
+    char* eol = strstr(p, "\r\n");
+    *eol = '\0';
+    char* colon = strchr(p, ':');
+    if (colon != nullptr && headerCount_ < MAX_HEADERS) {
+      *colon = '\0';
+      char* value = colon + 1;
+      while (*value == ' ' || *value == '\t') {
+        value++;
+      }
+      headers_[headerCount_++] = {p, value};
+    }
+    p = eol + 2;
+  }
+
+  const char* connection = headerValue("Connection");
+  if (connection != nullptr) {
+    c.keepAlive = strcasecmp(connection, "close") != 0 && (http11 || strcasecmp(connection, "keep-alive") == 0);
+  } else {
+    c.keepAlive = http11;
+  }
+  if (c.requests >= HTTP_MAX_REQUESTS_PER_CONNECTION) {
+    c.keepAlive = false;
+  }
+
+  if (query != nullptr) {
+    parseArgs(query);
+  }
+  const char* type = headerValue("Content-Type");
+  if (totalLen > headerLen && type != nullptr && strncasecmp(type, "application/x-www-form-urlencoded", 33) == 0) {
+    parseArgs(c.in + headerLen);
+  }
+  return true;
+}
+
+void HttpServer::parseArgs(char* s) {
+  while (*s != '\0' && argCount_ < MAX_ARGS) {
+    char* amp = strchr(s, '&');
+    if (amp != nullptr) {
+      *amp = '\0';
+    }
+    char* eq = strchr(s, '=');
+    char* value = (char*)"";
+    if (eq != nullptr) {
+      *eq = '\0';
+      value = eq + 1;
+    }
+    urlDecode(s);
+    urlDecode(value);
+    if (*s != '\0') {
+      args_[argCount_++] = {s, value};
+    }
+    if (amp == nullptr) {
+      break;
+    }
+    s = amp + 1;
+  }
+}
+
+// Literal characters must match exactly; "{name}" swallows one non-empty
+// path segment, which is copied to pathArgBuf_ so the path stays intact
+bool HttpServer::matchRoute(const char* pattern) {
+  const char* p = path_;
+  char* buf = pathArgBuf_;
+  char* bufEnd = pathArgBuf_ + sizeof(pathArgBuf_);
+  pathArgCount_ = 0;
+
+  while (*pattern != '\0') {
+    if (*pattern == '{') {
+      const char* close = strchr(pattern, '}');
+      size_t len = strcspn(p, "/");
+      if (close == nullptr || len == 0 || pathArgCount_ >= MAX_PATH_ARGS || buf + len + 1 > bufEnd) {
+        return false;
+      }
+      memcpy(buf, p, len);
+      buf[len] = '\0';
+      pathArgs_[pathArgCount_++] = buf;
+      buf += len + 1;
+      p += len;
+      pattern = close + 1;
+    } else if (*pattern++ != *p++) {
+      return false;
+    }
+  }
+  return *p == '\0';
+}
+
+void HttpServer::dispatch() {
+  for (uint8_t i = 0; i < routeCount_; i++) {
+    const Route& r = routes_[i];
+    if ((r.method == HTTP_ANY || r.method == method_) && matchRoute(r.uri)) {
+      if (middleware_ == nullptr || middleware_(r.tag)) {
+        r.handler();
+      }
+      return;
+    }
+  }
+  pathArgCount_ = 0;
+  if (notFound_ != nullptr) {
+    notFound_();
+  } else {
+    send(404, "text/plain", "Not Found");
+  }
+}
+
+void HttpServer::finishResponse(Connection& c) {
+  if (!c.keepAlive) {
+    close(c);
+    return;
+  }
+  c.state = CONN_READING;
+  c.lastActivity = millis();
+}
+
+void HttpServer::close(Connection& c) {
+  c.client.stop();
+  c.client = WiFiClient();
+  c.state = CONN_FREE;
+}
+
+// Sends as much pending output as the socket takes right now. Returns
+// true once everything has gone out.
+bool HttpServer::pump(Connection& c) {
+  int fd = c.client.fd();
+  while (c.outSent < c.outLen) {
+    int n = ::send(fd, c.out + c.outSent, c.outLen - c.outSent, MSG_DONTWAIT);
+    if (n <= 0) {
+      if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+        c.keepAlive = false;
+        c.outSent = c.outLen;
+        c.bodyLen = 0;
+        c.producer = nullptr;
+        return true;
+      }
+      return false;
+    }
+    c.outSent += n;
+    c.lastActivity = millis();
+  }
+  c.outLen = 0;
+  c.outSent = 0;
+
+  while (c.bodyLen > 0) {
+    int n = ::send(fd, c.body, c.bodyLen, MSG_DONTWAIT);
+    if (n <= 0) {
+      if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+        c.keepAlive = false;
+        c.bodyLen = 0;
+        c.producer = nullptr;
+        return true;
+      }
+      return false;
+    }
+    c.body += n;
+    c.bodyLen -= n;
+    c.lastActivity = millis();
+  }
+  return true;
+}
+
+// Like pump(), and refills the buffer from a sendStream() producer each
+// time it has drained. Stops when the socket is full; true once the whole
+// response is out.
+bool HttpServer::drain(Connection& c) {
+  while (pump(c)) {
+    if (c.producer == nullptr) {
+      return true;
+    }
+    produce(c);
+    // Closed on failure; a producer that wrote nothing is retried next pass
+    if (c.state == CONN_FREE || c.outLen == 0) {
+      return false;
+    }
+  }
+  return false;
+}
+
+void HttpServer::produce(Connection& c) {
+  current_ = &c;
+  headSent_ = true;
+  chunked_ = true;
+  failed_ = false;
+  if (!c.producer(*this, c.cursor)) {
+    c.producer = nullptr;
+    sendContent("", 0);
+  }
+  current_ = nullptr;
+  if (failed_) {
+    close(c);
+  }
+}
+
+// Appends to the current connection's output buffer. When it is full, the
+// socket gets what it takes right now; if that frees nothing the response
+// fails and the connection is dropped rather than waiting in loop().
+bool HttpServer::queue(const char* data, size_t length) {
+  Connection& c = *current_;
+  while (length > 0 && !failed_) {
+    size_t space = sizeof(c.out) - c.outLen;
+    if (space == 0) {
+      pump(c);
+      if (c.outSent > 0) {
+        memmove(c.out, c.out + c.outSent, c.outLen - c.outSent);
+        c.outLen -= c.outSent;
+        c.outSent = 0;
+      }
+      if (c.outLen == sizeof(c.out)) {
+        LOG_D("HTTP", "Response does not fit, dropping connection");
+        failed_ = true;
+        return false;
+      }
+      continue;
+    }
+    size_t n = length < space ? length : space;
+    memcpy(c.out + c.outLen, data, n);
+    c.outLen += n;
+    data += n;
+    length -= n;
+  }
+  return !failed_;
+}
+
+// ========================================
+// Request accessors
+// ========================================
+const char* HttpServer::argValue(const char* name) const {
+  for (uint8_t i = 0; i < argCount_; i++) {
+    if (strcmp(args_[i].name, name) == 0) {
+      return args_[i].value;
+    }
+  }
+  return nullptr;
+}
+
+String HttpServer::arg(const char* name) const {
+  const char* v = argValue(name);
+  return String(v != nullptr ? v : "");
+}
+
+const char* HttpServer::headerValue(const char* name) const {
+  for (uint8_t i = 0; i < headerCount_; i++) {
+    if (strcasecmp(headers_[i].name, name) == 0) {
+      return headers_[i].value;
+    }
+  }
+  return nullptr;
+}
+
+String HttpServer::header(const char* name) const {
+  const char* v = headerValue(name);
+  return String(v != nullptr ? v : "");
+}
+
+// ========================================
+// Response
+// ========================================
+void HttpServer::sendHeader(const char* name, const char* value, bool first) {
+  char line[160];
+  int n = snprintf(line, sizeof(line), "%s: %s\r\n", name, value);
+  if (n < 0 || (size_t)n >= sizeof(line) || extraLen_ + n > sizeof(extraHeaders_)) {
+    LOG_W("HTTP", "✗ Header %s dropped", name);
+    return;
+  }
+  if (first) {
+    memmove(extraHeaders_ + n, extraHeaders_, extraLen_);
+    memcpy(extraHeaders_, line, n);
+  } else {
+    memcpy(extraHeaders_ + extraLen_, line, n);
+  }
+  extraLen_ += n;
+}
+
+void HttpServer::writeHead(int code, const char* contentType, size_t length, bool chunked) {
+  char head[192];
+  int n = snprintf(head, sizeof(head), "HTTP/1.1 %d %s\r\n", code, statusText(code));
+  if (contentType != nullptr && contentType[0] != '\0') {
+    n += snprintf(head + n, sizeof(head) - n, "Content-Type: %s\r\n", contentType);
+  }
+  if (chunked) {
+    n += snprintf(head + n, sizeof(head) - n, "Transfer-Encoding: chunked\r\n");
+  } else {
+    n += snprintf(head + n, sizeof(head) - n, "Content-Length: %u\r\n", (unsigned)length);
+  }
+  n += snprintf(head + n, sizeof(head) - n, "Connection: %s\r\n", current_->keepAlive ? "keep-alive" : "close");
+  queue(head, n);
+  queue(extraHeaders_, extraLen_);
+  queue("\r\n", 2);
+  headSent_ = true;
+  extraLen_ = 0;
+}
+
+void HttpServer::send(int code, const char* contentType, const char* content) {
+  if (current_ == nullptr || headSent_) {
+    return;
+  }
+  size_t length = content != nullptr ? strlen(content) : 0;
+  if (contentLength_ == CONTENT_LENGTH_UNKNOWN) {
+    // HEAD gets the head alone: no chunks and no terminator
+    chunked_ = method_ != HTTP_HEAD;
+    writeHead(code, contentType, 0, true);
+    if (length > 0) {
+      sendContent(content, length);
+    }
+    return;
+  }
+  writeHead(code, contentType, length, false);
+  if (method_ != HTTP_HEAD) {
+    queue(content, length);
+  }
+}
+
+void HttpServer::send_P(int code, const char* contentType, const char* data, size_t length) {
+  if (current_ == nullptr || headSent_) {
+    return;
+  }
+  writeHead(code, contentType, length, false);
+  if (method_ == HTTP_HEAD) {
+    return;
+  }
+  // Static data is streamed from where it lives once the head is out
+  current_->body = (const uint8_t*)data;
+  current_->bodyLen = length;
+}
+
+void HttpServer::sendContent(const char* data, size_t length) {
+  if (current_ == nullptr || !headSent_) {
+    return;
+  }
+  if (!chunked_) {
+    if (method_ != HTTP_HEAD) {
+      queue(data, length);
+    }
+    return;
+  }
+  char size[12];
+  int n = snprintf(size, sizeof(size), "%x\r\n", (unsigned)length);
+  queue(size, n);
+  queue(data, length);
+  queue("\r\n", 2);
+  if (length == 0) {
+    chunked_ = false;
+  }
+}
+
+void HttpServer::sendStream(int code, const char* contentType, Producer produce, uint32_t start) {
+  if (current_ == nullptr || headSent_) {
+    return;
+  }
+  chunked_ = method_ != HTTP_HEAD;
+  writeHead(code, contentType, 0, true);
+  if (chunked_) {
+    current_->producer = produce;
+    current_->cursor = {start, start};
+  }
+}
+
+size_t HttpServer::room() const {
+  // Chunk size line and trailing CRLF
+  static const size_t FRAMING = 12;
+  if (current_ == nullptr) {
+    return 0;
+  }
+  size_t space = sizeof(current_->out) - current_->outLen;
+  return space > FRAMING ? space - FRAMING : 0;
+}
+
+WiFiClient HttpServer::client() {
+  if (current_ == nullptr) {
+    return WiFiClient();
+  }
+  detached_ = true;
+  return current_->client;
+}
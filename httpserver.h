@@ -0,0 +1,183 @@
+#ifndef HTTPSERVER_H
+#define HTTPSERVER_H
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <WiFiServer.h>
+#include "config.h"
+
+// Multi-connection HTTP/1.1 server with keep-alive, driven from loop().
+// Source-compatible with the parts of the Arduino WebServer API that
+// ledserver.cpp uses (on, arg, header, send, sendContent, client, ...).
+// Route patterns may contain "{name}" segments, read back with pathArg().
+//
+// Every connection has its own input and output buffer and a small state
+// machine. handleClient() never waits on a socket: it accepts, reads what
+// has arrived, runs handlers for complete requests and pushes pending
+// output with non-blocking sends. A slow or stalled browser only holds its
+// own slot. A handler's response has to fit the output buffer plus what
+// the socket takes at once; longer bodies are produced piecewise with
+// sendStream(), resumed from handleClient() as the client reads.
+
+enum HTTPMethod : uint8_t {
+  HTTP_ANY,
+  HTTP_GET,
+  HTTP_HEAD,
+  HTTP_POST,
+  HTTP_PUT,
+  HTTP_PATCH,
+  HTTP_DELETE,
+  HTTP_OPTIONS
+};
+
+#ifndef CONTENT_LENGTH_UNKNOWN
+#define CONTENT_LENGTH_UNKNOWN ((size_t) -1)
+#endif
+
+class HttpServer {
+ public:
+  typedef void (*Handler)();
+  // Runs before the handler of every matched route with that route's tag.
+  // Returning false skips the handler; the middleware has replied itself.
+  typedef bool (*Middleware)(uint8_t tag);
+
+  // Where a streamed body continues, kept on the connection between calls
+  struct StreamCursor {
+    uint32_t start;
+    uint32_t next;
+  };
+  // Writes the next part of a streamed body with sendContent(), at most
+  // room() bytes, and returns false once the body is complete. Runs from
+  // handleClient() after the request is gone, so it must not read request
+  // data; what it needs goes into the cursor.
+  typedef bool (*Producer)(HttpServer& server, StreamCursor& cursor);
+
+  static const uint8_t MAX_ROUTES = 32;
+  static const uint8_t MAX_HEADERS = 20;
+  static const uint8_t MAX_ARGS = 16;
+  static const uint8_t MAX_PATH_ARGS = 4;
+
+  explicit HttpServer(uint16_t port);
+
+  void begin();
+  void handleClient();
+
+  void on(const char* uri, HTTPMethod method, Handler handler, uint8_t tag = 0);
+  void onNotFound(Handler handler) { notFound_ = handler; }
+  void use(Middleware middleware) { middleware_ = middleware; }
+  // All request headers are kept; accepted for WebServer compatibility
+  void collectHeaders(const char*[], size_t) {}
+
+  // Request, valid inside a handler
+  String uri() const { return String(path_); }
+  const char* path() const { return path_; }
+  HTTPMethod method() const { return method_; }
+  bool hasArg(const char* name) const { return argValue(name) != nullptr; }
+  String arg(const char* name) const;
+  const char* argValue(const char* name) const;
+  // "{...}" segments of the matched route, in order
+  const char* pathArg(uint8_t index) const { return index < pathArgCount_ ? pathArgs_[index] : ""; }
+  uint8_t pathArgs() const { return pathArgCount_; }
+  bool hasHeader(const char* name) const { return headerValue(name) != nullptr; }
+  String header(const char* name) const;
+  const char* headerValue(const char* name) const;
+
+  // Response
+  void sendHeader(const char* name, const char* value, bool first = false);
+  void sendHeader(const char* name, const String& value, bool first = false) { sendHeader(name, value.c_str(), first); }
+  void setContentLength(size_t length) { contentLength_ = length; }
+  void send(int code, const char* contentType = nullptr, const char* content = "");
+  void send(int code, const char* contentType, const String& content) { send(code, contentType, content.c_str()); }
+  // data must stay valid after the handler returns (flash/static storage)
+  void send_P(int code, const char* contentType, const char* data, size_t length);
+  void sendContent(const char* data, size_t length);
+  void sendContent(const String& content) { sendContent(content.c_str(), content.length()); }
+  // Chunked response whose body comes from produce, called whenever the
+  // output buffer has drained; cursor starts as {start, start}
+  void sendStream(int code, const char* contentType, Producer produce, uint32_t start = 0);
+  // Bytes one sendContent() call can still add without waiting
+  size_t room() const;
+
+  // Hands the socket to the handler (used for event streams); the server
+  // forgets the connection without closing it
+  WiFiClient client();
+
+  uint8_t activeConnections() const;
+
+ private:
+  enum ConnState : uint8_t { CONN_FREE, CONN_READING, CONN_WRITING };
+
+  struct Connection {
+    WiFiClient client;
+    ConnState state;
+    bool keepAlive;
+    uint8_t requests;
+    uint16_t inLen;
+    uint16_t outLen;
+    uint16_t outSent;
+    const uint8_t* body;  // static body streamed after out[]
+    size_t bodyLen;
+    Producer producer;    // rest of a sendStream() body
+    StreamCursor cursor;
+    unsigned long lastActivity;
+    char in[HTTP_REQUEST_BUFFER];
+    char out[HTTP_RESPONSE_BUFFER];
+  };
+
+  struct Route {
+    const char* uri;
+    HTTPMethod method;
+    uint8_t tag;
+    Handler handler;
+  };
+
+  struct Pair {
+    const char* name;
+    const char* value;
+  };
+
+  void accept();
+  void readFrom(Connection& c);
+  bool requestComplete(Connection& c, size_t& headerLen, size_t& totalLen);
+  void process(Connection& c, size_t headerLen, size_t totalLen);
+  bool parseRequest(Connection& c, size_t headerLen, size_t totalLen);
+  void parseArgs(char* s);
+  void dispatch();
+  bool matchRoute(const char* pattern);
+  void finishResponse(Connection& c);
+  bool pump(Connection& c);
+  bool drain(Connection& c);
+  void produce(Connection& c);
+  bool queue(const char* data, size_t length);
+  void writeHead(int code, const char* contentType, size_t length, bool chunked);
+  void close(Connection& c);
+  void reject(WiFiClient& client, int code);
+
+  WiFiServer listener_;
+  Connection conns_[HTTP_MAX_CONNECTIONS];
+  Route routes_[MAX_ROUTES];
+  uint8_t routeCount_;
+  Handler notFound_;
+  Middleware middleware_;
+
+  // Current request (one handler runs at a time)
+  Connection* current_;
+  HTTPMethod method_;
+  char* path_;
+  Pair headers_[MAX_HEADERS];
+  uint8_t headerCount_;
+  Pair args_[MAX_ARGS];
+  uint8_t argCount_;
+  const char* pathArgs_[MAX_PATH_ARGS];
+  uint8_t pathArgCount_;
+  char pathArgBuf_[64];
+  char extraHeaders_[384];
+  size_t extraLen_;
+  size_t contentLength_;
+  bool headSent_;
+  bool chunked_;
+  bool detached_;
+  bool failed_;
+};
+
+#endif // HTTPSERVER_H
@@ -0,0 +1,365 @@
+#ifndef LEDJSON_H
+#define LEDJSON_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Allocation-free JSON reader for LED control payloads such as
+//   {"state":"on","r":255,"g":64,"b":0,"brightness":120,"transition_ms":500}
+//   {"start":10,"count":20,"r":0,"g":0,"b":255}
+//   {"segment":2,"r":255,"g":0,"b":0}
+//   {"start":10,"pixels":[[255,0,0],[0,255,0],[0,0,255]]}
+//   {"effect":"breathe","r":0,"g":0,"b":255,"transition_ms":3000}
+// Keys may come in any order and unknown keys are skipped. Works on the
+// MQTT buffer in place; nothing is copied and it needs no NUL terminator.
+
+struct LEDCommand {
+  bool hasState;
+  bool state;
+  bool hasRed, hasGreen, hasBlue;
+  uint8_t red, green, blue;
+  bool hasBrightness;
+  uint8_t brightness;
+  bool hasTransition;
+  uint32_t transitionMs;
+  uint16_t start;       // first pixel of a range, or of "pixels"
+  bool hasCount;
+  uint16_t count;       // range length for r/g/b; without it the whole strip
+  bool hasSegment;
+  uint8_t segment;      // configured segment id, overrides start/count
+  const char* effect;   // effect name (not NUL-terminated), nullptr if absent
+  size_t effectLength;
+  const char* pixels;   // raw span of the "pixels" array, see forEachPixel()
+  size_t pixelsLength;
+  bool hasAt;
+  int64_t at;           // epoch ms to apply at, see pendingcommands.h
+};
+
+class JsonCursor {
+ public:
+  JsonCursor(const char* json, size_t length) : p_(json), end_(json + length) {}
+
+  const char* position() const { return p_; }
+  bool atEnd() { skipWhitespace(); return p_ >= end_; }
+
+  bool consume(char c) {
+    skipWhitespace();
+    if (p_ < end_ && *p_ == c) {
+      p_++;
+      return true;
+    }
+    return false;
+  }
+
+  bool peek(char c) {
+    skipWhitespace();
+    return p_ < end_ && *p_ == c;
+  }
+
+  // Points str/len at the raw (still escaped) string contents
+  bool readString(const char*& str, size_t& len) {
+    if (!consume('"')) {
+      return false;
+    }
+    str = p_;
+    while (p_ < end_ && *p_ != '"') {
+      if (*p_ == '\\') {
+        p_++;
+      }
+      p_++;
+    }
+    if (p_ >= end_) {
+      return false;
+    }
+    len = p_ - str;
+    p_++;
+    return true;
+  }
+
+  // Integer part of a JSON number; fraction and exponent are dropped
+  bool readNumber(long& value) {
+    skipWhitespace();
+    bool negative = false;
+    if (p_ < end_ && *p_ == '-') {
+      negative = true;
+      p_++;
+    }
+    if (p_ >= end_ || *p_ < '0' || *p_ > '9') {
+      return false;
+    }
+    long v = 0;
+    while (p_ < end_ && *p_ >= '0' && *p_ <= '9') {
+      if (v < 100000000L) {
+        v = v * 10 + (*p_ - '0');
+      }
+      p_++;
+    }
+    while (p_ < end_ && (*p_ == '.' || *p_ == 'e' || *p_ == 'E' || *p_ == '+' || *p_ == '-' ||
+                         (*p_ >= '0' && *p_ <= '9'))) {
+      p_++;
+    }
+    value = negative ? -v : v;
+    return true;
+  }
+
+  // Like readNumber() but 64 bits wide, for epoch milliseconds
+  bool readInt64(int64_t& value) {
+    skipWhitespace();
+    bool negative = false;
+    if (p_ < end_ && *p_ == '-') {
+      negative = true;
+      p_++;
+    }
+    if (p_ >= end_ || *p_ < '0' || *p_ > '9') {
+      return false;
+    }
+    int64_t v = 0;
+    while (p_ < end_ && *p_ >= '0' && *p_ <= '9') {
+      if (v < 100000000000000000LL) {
+        v = v * 10 + (*p_ - '0');
+      }
+      p_++;
+    }
+    while (p_ < end_ && (*p_ == '.' || *p_ == 'e' || *p_ == 'E' || *p_ == '+' || *p_ == '-' ||
+                         (*p_ >= '0' && *p_ <= '9'))) {
+      p_++;
+    }
+    value = negative ? -v : v;
+    return true;
+  }
+
+  bool readLiteral(const char* word) {
+    skipWhitespace();
+    size_t n = strlen(word);
+    if ((size_t)(end_ - p_) < n || memcmp(p_, word, n) != 0) {
+      return false;
+    }
+    p_ += n;
+    return true;
+  }
+
+  // Payloads are untrusted; deeper nesting fails instead of recursing on
+  // the loop task's stack
+  static const uint8_t MAX_DEPTH = 8;
+
+  // Skips one complete value of any type, including nested containers
+  bool skipValue(uint8_t depth = 0) {
+    skipWhitespace();
+    if (p_ >= end_) {
+      return false;
+    }
+    const char* s;
+    size_t n;
+    long v;
+    switch (*p_) {
+      case '"':
+        return readString(s, n);
+      case '{':
+      case '[': {
+        if (depth >= MAX_DEPTH) {
+          return false;
+        }
+        char close = *p_ == '{' ? '}' : ']';
+        p_++;
+        if (consume(close)) {
+          return true;
+        }
+        do {
+          if (close == '}' && !(readString(s, n) && consume(':'))) {
+            return false;
+          }
+          if (!skipValue(depth + 1)) {
+            return false;
+          }
+        } while (consume(','));
+        return consume(close);
+      }
+      case 't':
+        return readLiteral("true");
+      case 'f':
+        return readLiteral("false");
+      case 'n':
+        return readLiteral("null");
+      default:
+        return readNumber(v);
+    }
+  }
+
+ private:
+  void skipWhitespace() {
+    while (p_ < end_ && (*p_ == ' ' || *p_ == '\t' || *p_ == '\n' || *p_ == '\r')) {
+      p_++;
+    }
+  }
+
+  const char* p_;
+  const char* end_;
+};
+
+inline uint8_t clampByte(long v) {
+  return v < 0 ? 0 : (v > 255 ? 255 : (uint8_t)v);
+}
+
+inline uint16_t clampIndex(long v) {
+  return v < 0 ? 0 : (v > 0xFFFF ? 0xFFFF : (uint16_t)v);
+}
+
+inline bool keyIs(const char* key, size_t len, const char* name) {
+  return strlen(name) == len && memcmp(key, name, len) == 0;
+}
+
+// Parses a top-level LED control object. Returns false on malformed input.
+inline bool parseLEDCommand(const char* json, size_t length, LEDCommand& cmd) {
+  memset(&cmd, 0, sizeof(cmd));
+  JsonCursor in(json, length);
+
+  if (!in.consume('{')) {
+    return false;
+  }
+  if (in.consume('}')) {
+    return true;
+  }
+
+  do {
+    const char* key;
+    size_t keyLen;
+    long v;
+    if (!in.readString(key, keyLen) || !in.consume(':')) {
+      return false;
+    }
+
+    if (keyIs(key, keyLen, "r")) {
+      if (!in.readNumber(v)) {
+        return false;
+      }
+      cmd.hasRed = true;
+      cmd.red = clampByte(v);
+    }
+    else if (keyIs(key, keyLen, "g")) {
+      if (!in.readNumber(v)) {
+        return false;
+      }
+      cmd.hasGreen = true;
+      cmd.green = clampByte(v);
+    }
+    else if (keyIs(key, keyLen, "b")) {
+      if (!in.readNumber(v)) {
+        return false;
+      }
+      cmd.hasBlue = true;
+      cmd.blue = clampByte(v);
+    }
+    else if (keyIs(key, keyLen, "brightness")) {
+      if (!in.readNumber(v)) {
+        return false;
+      }
+      cmd.hasBrightness = true;
+      cmd.brightness = clampByte(v);
+    }
+    else if (keyIs(key, keyLen, "transition_ms")) {
+      if (!in.readNumber(v)) {
+        return false;
+      }
+      cmd.hasTransition = true;
+      cmd.transitionMs = v < 0 ? 0 : (uint32_t)v;
+    }
+    else if (keyIs(key, keyLen, "start")) {
+      if (!in.readNumber(v)) {
+        return false;
+      }
+      cmd.start = clampIndex(v);
+    }
+    else if (keyIs(key, keyLen, "count")) {
+      if (!in.readNumber(v)) {
+        return false;
+      }
+      cmd.hasCount = true;
+      cmd.count = clampIndex(v);
+    }
+    else if (keyIs(key, keyLen, "segment")) {
+      if (!in.readNumber(v)) {
+        return false;
+      }
+      cmd.hasSegment = true;
+      cmd.segment = clampByte(v);
+    }
+    else if (keyIs(key, keyLen, "state")) {
+      const char* str;
+      size_t strLen;
+      if (in.peek('"')) {
+        if (!in.readString(str, strLen)) {
+          return false;
+        }
+        cmd.hasState = keyIs(str, strLen, "on") || keyIs(str, strLen, "off");
+        cmd.state = keyIs(str, strLen, "on");
+      } else if (in.readLiteral("true")) {
+        cmd.hasState = true;
+        cmd.state = true;
+      } else if (in.readLiteral("false")) {
+        cmd.hasState = true;
+        cmd.state = false;
+      } else {
+        return false;
+      }
+    }
+    else if (keyIs(key, keyLen, "at")) {
+      if (!in.readInt64(cmd.at)) {
+        return false;
+      }
+      cmd.hasAt = true;
+    }
+    else if (keyIs(key, keyLen, "effect")) {
+      if (!in.readString(cmd.effect, cmd.effectLength)) {
+        return false;
+      }
+    }
+    else if (keyIs(key, keyLen, "pixels")) {
+      // Only remember where the array is: "start" may still follow
+      const char* begin = in.position();
+      if (!in.skipValue()) {
+        return false;
+      }
+      cmd.pixels = begin;
+      cmd.pixelsLength = in.position() - begin;
+    }
+    else if (!in.skipValue()) {
+      return false;
+    }
+  } while (in.consume(','));
+
+  return in.consume('}');
+}
+
+// Decodes "pixels":[[r,g,b],...] and calls fn(index, r, g, b) for each
+// entry, index already offset by "start". Returns the number of pixels.
+template <typename Fn>
+size_t forEachPixel(const LEDCommand& cmd, Fn fn) {
+  if (cmd.pixels == nullptr) {
+    return 0;
+  }
+  JsonCursor in(cmd.pixels, cmd.pixelsLength);
+  if (!in.consume('[') || in.consume(']')) {
+    return 0;
+  }
+
+  size_t count = 0;
+  do {
+    long rgb[3];
+    if (!in.consume('[')) {
+      break;
+    }
+    bool ok = in.readNumber(rgb[0]) && in.consume(',') &&
+              in.readNumber(rgb[1]) && in.consume(',') &&
+              in.readNumber(rgb[2]) && in.consume(']');
+    if (!ok) {
+      break;
+    }
+    fn((size_t)cmd.start + count, clampByte(rgb[0]), clampByte(rgb[1]), clampByte(rgb[2]));
+    count++;
+  } while (in.consume(','));
+
+  return count;
+}
+
+#endif // LEDJSON_H
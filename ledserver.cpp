@@ -1,411 +1,238 @@
-#include <WebServer.h>
 #include "ledserver.h"
 #include <Arduino.h>
 #include <WiFi.h>
+#include <lwip/sockets.h>
 #include "user_roles.h"
 #include "pins.h"
+#include "webassets.h"
+#include "ledstate.h"
+#include "renderer.h"
+#include "commandtable.h"
+#include "sessionstore.h"
+#include "activitylog.h"
+#include "responsewriter.h"
+#include "log.h"
+#include "metrics.h"
+
+HttpServer server(80);
+
+ActivityLog activityLog;
+
+// Dashboard tabs subscribed to /events (Server-Sent Events)
+struct EventClient {
+  WiFiClient client;
+  bool active;
+  bool canViewLogs;
+  uint8_t token[SESSION_TOKEN_BYTES];  // session the stream was opened with
+};
 
-extern struct LEDState {
-  bool isOn;
-  uint8_t red;
-  uint8_t green;
-  uint8_t blue;
-  uint8_t brightness;
-  bool changed;
-} ledState;
-
-extern void setLED(bool state, uint8_t r, uint8_t g, uint8_t b);
+const int MAX_EVENT_CLIENTS = 5;
+const unsigned long EVENT_KEEPALIVE_INTERVAL = 15000;
+EventClient eventClients[MAX_EVENT_CLIENTS];
+unsigned long lastEventKeepAlive = 0;
 
-WebServer server(80);
+// Session of the request being handled, resolved once by authorize()
+Session* requestSession = nullptr;
 
-struct ActivityLog {
-  String timestamp;
-  String username;
-  String action;
-};
+// Forward declarations - MUST be after struct definitions
+Session* getSessionFromRequest();
+void addLog(const char* username, LogAction action, const LogArgs& args = LogArgs());
+void pushEvent(const char* event, const char* data, bool logsOnly);
+void buzz(uint32_t durationMs);  // main.cpp
+
+void addLog(const char* username, LogAction action, const LogArgs& args) {
+  LogRecord rec;
+  rec.timestamp = millis() / 1000;
+  rec.user = userIdFor(username);
+  rec.action = action;
+  rec.args = args;
+  uint32_t seq = activityLog.push(rec);
+
+  char json[160];
+  formatLogJson(rec, seq, json, sizeof(json));
+  LOG_I("LOG", "%s", json);
+  pushEvent("log", json, true);
+}
 
-ActivityLog activityLogs[50];
-int logIndex = 0;
+// ========================================
+// Server-Sent Events
+// ========================================
+int formatLEDStateJson(char* buf, size_t len) {
+  return snprintf(buf, len, "{\"state\":\"%s\",\"red\":%d,\"green\":%d,\"blue\":%d,\"brightness\":%d,\"pixels\":%u}",
+                  ledState.isOn ? "on" : "off", ledState.red, ledState.green, ledState.blue, ledState.brightness, frame.size());
+}
 
-struct Session {
-  String token;
-  String username;
-  UserRole role;
-  unsigned long loginTime;
-};
+void closeEventClient(EventClient& ec) {
+  ec.client.stop();
+  ec.active = false;
+}
 
-Session activeSessions[10];
-const unsigned long SESSION_TIMEOUT = 3600000;
+// Frames go out with one non-blocking send. A stream that cannot take a
+// whole frame right now is closed instead of holding loop(); the browser
+// reconnects after the retry delay and gets the current state.
+bool sendEventFrame(EventClient& ec, const char* frame, size_t len) {
+  int n = ::send(ec.client.fd(), frame, len, MSG_DONTWAIT);
+  if (n != (int)len) {
+    LOG_D("SSE", "Stream not keeping up, closing it");
+    closeEventClient(ec);
+    return false;
+  }
+  return true;
+}
 
-// Forward declarations - MUST be after struct definitions
-Session* getSessionFromRequest();
-Session* validateSession(String token);
-String createSession(String username, UserRole role);
-String generateToken();
-void addLog(String username, String action);
-void handleDashboard();
-void handleRoot();
-void handleLogin();
-
-void addLog(String username, String action) {
-  activityLogs[logIndex].timestamp = String(millis() / 1000) + "s";
-  activityLogs[logIndex].username = username;
-  activityLogs[logIndex].action = action;
-  logIndex = (logIndex + 1) % 50;
-  Serial.println("[LOG] " + username + ": " + action);
+// Streams are authorized when they open and re-checked before every push,
+// so logging out or letting the session expire ends them too
+bool eventClientLive(EventClient& ec) {
+  if (!ec.client.connected() || !sessions.contains(ec.token, millis())) {
+    closeEventClient(ec);
+    return false;
+  }
+  return true;
 }
 
-String generateToken() {
-  String token = "";
-  for (int i = 0; i < 32; i++) {
-    token += String(random(0, 16), HEX);
+void closeEventClientsFor(const Session* session) {
+  for (int i = 0; i < MAX_EVENT_CLIENTS; i++) {
+    EventClient& ec = eventClients[i];
+    if (ec.active && memcmp(ec.token, session->token, SESSION_TOKEN_BYTES) == 0) {
+      closeEventClient(ec);
+    }
   }
-  return token;
 }
 
-String createSession(String username, UserRole role) {
-  String token = generateToken();
-  int slot = 0;
-  unsigned long oldestTime = activeSessions[0].loginTime;
-  
-  for (int i = 0; i < 10; i++) {
-    if (activeSessions[i].token == "") {
-      slot = i;
-      break;
+void pushEvent(const char* event, const char* data, bool logsOnly) {
+  char frame[224];
+  int len = -1;
+  for (int i = 0; i < MAX_EVENT_CLIENTS; i++) {
+    EventClient& ec = eventClients[i];
+    if (!ec.active || (logsOnly && !ec.canViewLogs) || !eventClientLive(ec)) {
+      continue;
     }
-    if (activeSessions[i].loginTime < oldestTime) {
-      oldestTime = activeSessions[i].loginTime;
-      slot = i;
+    if (len < 0) {
+      len = snprintf(frame, sizeof(frame), "event: %s\ndata: %s\n\n", event, data);
+      if (len >= (int)sizeof(frame)) {
+        LOG_W("SSE", "✗ %s event too long, dropped", event);
+        return;
+      }
     }
+    sendEventFrame(ec, frame, len);
   }
-  
-  activeSessions[slot].token = token;
-  activeSessions[slot].username = username;
-  activeSessions[slot].role = role;
-  activeSessions[slot].loginTime = millis();
-  
-  Serial.println("[SESSION] Created for " + username + " - Token: " + token.substring(0, 8) + "...");
-  return token;
 }
 
-Session* validateSession(String token) {
-  Serial.println("[SESSION] Validating token: " + token.substring(0, 8) + "...");
-  
-  for (int i = 0; i < 10; i++) {
-    if (activeSessions[i].token.length() > 0) {
-      Serial.println("[SESSION] Slot " + String(i) + " token: " + activeSessions[i].token.substring(0, 8) + "... User: " + activeSessions[i].username);
-      
-      if (activeSessions[i].token == token) {
-        Serial.println("[SESSION] Token match found in slot " + String(i));
-        
-        if (millis() - activeSessions[i].loginTime > SESSION_TIMEOUT) {
-          Serial.println("[SESSION] Token expired");
-          activeSessions[i].token = "";
-          return nullptr;
-        }
-        
-        Serial.println("[SESSION] ✓ Token valid for: " + activeSessions[i].username);
-        return &activeSessions[i];
-      }
+void notifyLEDStateChanged() {
+  char json[120];
+  formatLEDStateJson(json, sizeof(json));
+  pushEvent("led", json, false);
+}
+
+// Called from loop(): drops closed streams and those whose session ended,
+// and keeps idle ones alive through proxies. Costs nothing when no tab is open.
+void handleEventClients() {
+  if (millis() - lastEventKeepAlive < EVENT_KEEPALIVE_INTERVAL) {
+    return;
+  }
+  lastEventKeepAlive = millis();
+
+  for (int i = 0; i < MAX_EVENT_CLIENTS; i++) {
+    EventClient& ec = eventClients[i];
+    if (ec.active && eventClientLive(ec)) {
+      sendEventFrame(ec, ": keepalive\n\n", 13);
     }
   }
-  
-  Serial.println("[SESSION] ✗ Token not found in any slot");
-  return nullptr;
+}
+
+void handleEvents() {
+  Session* session = requestSession;
+  int slot = -1;
+  for (int i = 0; i < MAX_EVENT_CLIENTS; i++) {
+    if (!eventClients[i].active || !eventClients[i].client.connected()) {
+      slot = i;
+      break;
+    }
+  }
+  if (slot == -1) {
+    server.send(503, "application/json", "{\"error\":\"Too many event streams\"}");
+    return;
+  }
+
+  // Take over the socket: the server forgets the connection once
+  // client() is called, our copy keeps the stream open.
+  EventClient& ec = eventClients[slot];
+  ec.client.stop();
+  ec.client = server.client();
+  ec.active = true;
+  ec.canViewLogs = getPermissions(session->role).canViewLogs;
+  memcpy(ec.token, session->token, SESSION_TOKEN_BYTES);
+
+  // Head and current state as one frame
+  char open[320];
+  int len = snprintf(open, sizeof(open),
+                     "HTTP/1.1 200 OK\r\n"
+                     "Content-Type: text/event-stream\r\n"
+                     "Cache-Control: no-cache\r\n"
+                     "Connection: keep-alive\r\n\r\n"
+                     "retry: 3000\n\n"
+                     "event: led\ndata: ");
+  len += formatLEDStateJson(open + len, sizeof(open) - len);
+  len += snprintf(open + len, sizeof(open) - len, "\n\n");
+  if (len >= (int)sizeof(open) || !sendEventFrame(ec, open, len)) {
+    return;
+  }
+
+  LOG_I("SSE", "Stream opened for %s (slot %d)", session->username, slot);
 }
 
 Session* getSessionFromRequest() {
-  Serial.println("[SESSION] === Checking for session cookie ===");
-  
-  // Print all headers for debugging
-  Serial.println("[SESSION] All headers:");
-  for (int i = 0; i < server.headers(); i++) {
-    Serial.println("  " + server.headerName(i) + ": " + server.header(i));
+  if (!server.hasHeader("Cookie")) {
+    return nullptr;
   }
-  
-  if (server.hasHeader("Cookie")) {
-    String cookie = server.header("Cookie");
-    Serial.println("[SESSION] Cookie header found: " + cookie);
-    
-    int tokenStart = cookie.indexOf("session=");
-    if (tokenStart != -1) {
-      tokenStart += 8; // Length of "session="
-      int tokenEnd = cookie.indexOf(";", tokenStart);
-      String token;
-      
-      if (tokenEnd == -1) {
-        token = cookie.substring(tokenStart);
-      } else {
-        token = cookie.substring(tokenStart, tokenEnd);
-      }
-      
-      // Remove any whitespace from token
-      token.trim();
-      
-      Serial.println("[SESSION] Extracted token: " + token);
-      Serial.println("[SESSION] Token length: " + String(token.length()));
-      
-      Session* session = validateSession(token);
-      
-      if (session != nullptr) {
-        Serial.println("[SESSION] ✓ Valid session for: " + session->username);
-      } else {
-        Serial.println("[SESSION] ✗ Session validation failed");
-      }
-      
-      return session;
-    } else {
-      Serial.println("[SESSION] ✗ No 'session=' found in cookie");
-      Serial.println("[SESSION] Cookie contents: " + cookie);
+  String cookie = server.header("Cookie");
+  const char* c = cookie.c_str();
+
+  // Find "session=" at the start of the header or of a "; " separated pair
+  const char* p = c;
+  while ((p = strstr(p, "session=")) != nullptr) {
+    if (p == c || p[-1] == ' ' || p[-1] == ';') {
+      break;
     }
-  } else {
-    Serial.println("[SESSION] ✗ No Cookie header present");
+    p++;
   }
-  
-  Serial.println("[SESSION] === Session check complete: NULL ===");
-  return nullptr;
+  if (p == nullptr) {
+    return nullptr;
+  }
+  p += 8;  // strlen("session=")
+  size_t len = strcspn(p, "; \t");
+  return sessions.findHex(p, len, millis());
+}
+
+// Serve a gzipped page straight from flash. The ETag is a hash of the
+// compressed bytes, so browsers revalidate and get a 304 until reflashed.
+void sendGzipAsset(const uint8_t* data, size_t len, const char* etag) {
+  server.sendHeader("ETag", etag);
+  server.sendHeader("Cache-Control", "no-cache");
+
+  if (server.hasHeader("If-None-Match") && server.header("If-None-Match") == etag) {
+    server.send(304);
+    return;
+  }
+
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, "text/html", (PGM_P)data, len);
 }
 
 void handleRoot() {
-  Serial.println("[WEB] Root page requested");
-  Session* session = getSessionFromRequest();
-  
-  if (session != nullptr) {
-    Serial.println("[WEB] User already logged in, redirecting to dashboard");
-    handleDashboard();
+  LOG_D("WEB", "Root page requested");
+  if (requestSession != nullptr) {
+    LOG_D("WEB", "User already logged in, serving dashboard");
+    sendGzipAsset(DASHBOARD_HTML_GZ, DASHBOARD_HTML_GZ_LEN, DASHBOARD_HTML_ETAG);
     return;
   }
 
-  String html = R"rawliteral(<!DOCTYPE html>
-<html>
-<head>
-  <meta charset="UTF-8">
-  <meta name="viewport" content="width=device-width, initial-scale=1.0">
-  <title>ESP32 LED - Login</title>
-  <style>
-    * { margin: 0; padding: 0; box-sizing: border-box; }
-    body { 
-      font-family: 'Segoe UI', Arial, sans-serif;
-      background: linear-gradient(135deg, #667eea 0%, #764ba2 100%);
-      min-height: 100vh;
-      display: flex;
-      align-items: center;
-      justify-content: center;
-      padding: 20px;
-    }
-    .login-container {
-      background: white;
-      padding: 40px;
-      border-radius: 15px;
-      box-shadow: 0 10px 40px rgba(0,0,0,0.2);
-      width: 100%;
-      max-width: 450px;
-    }
-    h1 { color: #333; margin-bottom: 10px; text-align: center; }
-    .subtitle { color: #666; text-align: center; margin-bottom: 30px; font-size: 14px; }
-    .form-group { margin-bottom: 20px; }
-    label { display: block; margin-bottom: 5px; color: #555; font-weight: 500; }
-    input {
-      width: 100%;
-      padding: 12px;
-      border: 2px solid #ddd;
-      border-radius: 8px;
-      font-size: 16px;
-      transition: border-color 0.3s;
-    }
-    input:focus { outline: none; border-color: #667eea; }
-    .button {
-      width: 100%;
-      padding: 14px;
-      background: linear-gradient(135deg, #667eea 0%, #764ba2 100%);
-      color: white;
-      border: none;
-      border-radius: 8px;
-      font-size: 16px;
-      font-weight: 600;
-      cursor: pointer;
-      transition: transform 0.2s, box-shadow 0.2s;
-    }
-    .button:hover {
-      transform: translateY(-2px);
-      box-shadow: 0 5px 20px rgba(102, 126, 234, 0.4);
-    }
-    .button:active { transform: translateY(0); }
-    #message {
-      margin-top: 15px;
-      padding: 12px;
-      border-radius: 8px;
-      text-align: center;
-      display: none;
-    }
-    .error { background: #fee; color: #c33; display: block; }
-    .success { background: #efe; color: #3c3; display: block; }
-    .credentials {
-      margin-top: 20px;
-      padding: 15px;
-      background: #f5f5f5;
-      border-radius: 8px;
-      font-size: 12px;
-      color: #666;
-    }
-    .credentials strong { color: #333; display: block; margin-bottom: 8px; }
-    .cred-row { 
-      padding: 6px 0; 
-      border-bottom: 1px solid #e0e0e0;
-    }
-    .cred-row:last-child { border-bottom: none; }
-    .role-badge {
-      display: inline-block;
-      padding: 2px 8px;
-      border-radius: 10px;
-      font-size: 10px;
-      font-weight: bold;
-      margin-left: 8px;
-    }
-    .badge-admin { background: #ff5722; color: white; }
-    .badge-mod { background: #ff9800; color: white; }
-    .badge-viewer { background: #2196F3; color: white; }
-    .badge-guest { background: #9e9e9e; color: white; }
-  </style>
-</head>
-<body>
-  <div class="login-container">
-    <h1>🔐 ESP32 LED Control</h1>
-    <p class="subtitle">Role-Based Access Control System</p>
-    
-    <form id="loginForm" onsubmit="return handleLogin(event)">
-      <div class="form-group">
-        <label for="username">Username</label>
-        <input type="text" id="username" name="username" required autocomplete="username">
-      </div>
-      <div class="form-group">
-        <label for="password">Password</label>
-        <input type="password" id="password" name="password" required autocomplete="current-password">
-      </div>
-      <button type="submit" class="button">Login</button>
-    </form>
-    
-    <div id="message"></div>
-    
-    <div class="credentials">
-      <strong>🔑 Test Accounts & Permissions:</strong>
-      <div class="cred-row">
-        <span class="role-badge badge-admin">ADMIN</span> admin / admin123<br>
-        <small style="color: #888;">✓ Full Control + Settings</small>
-      </div>
-      <div class="cred-row">
-        <span class="role-badge badge-mod">MOD</span> moderator / mod123<br>
-        <small style="color: #888;">✓ LED Control + View Logs</small>
-      </div>
-      <div class="cred-row">
-        <span class="role-badge badge-viewer">VIEW</span> viewer / view123<br>
-        <small style="color: #888;">✓ View Status + Logs Only</small>
-      </div>
-      <div class="cred-row">
-        <span class="role-badge badge-guest">GUEST</span> guest / guest123<br>
-        <small style="color: #888;">✓ View Status Only</small>
-      </div>
-    </div>
-  </div>
-
-  <script>
-    function handleLogin(e) {
-      e.preventDefault();
-      
-      const username = document.getElementById('username').value;
-      const password = document.getElementById('password').value;
-      const message = document.getElementById('message');
-      
-      console.log('=== LOGIN ATTEMPT ===');
-      console.log('Username:', username);
-      console.log('Password length:', password.length);
-      
-      message.textContent = '⏳ Authenticating...';
-      message.className = '';
-      message.style.display = 'block';
-      
-      const formData = 'username=' + encodeURIComponent(username) + '&password=' + encodeURIComponent(password);
-      console.log('Sending POST to /login');
-      
-      fetch('/login', {
-        method: 'POST',
-        headers: { 'Content-Type': 'application/x-www-form-urlencoded' },
-        body: formData,
-        credentials: 'include'
-      })
-      .then(response => {
-        console.log('Response received');
-        console.log('Status:', response.status);
-        
-        console.log('Headers:');
-        response.headers.forEach((value, key) => {
-          console.log('  ' + key + ':', value);
-        });
-        
-        // Check if Set-Cookie header is present
-        const setCookie = response.headers.get('set-cookie');
-        console.log('Set-Cookie header:', setCookie);
-        
-        if (!response.ok) {
-          throw new Error('HTTP ' + response.status);
-        }
-        
-        return response.json();
-      })
-      .then(data => {
-        console.log('Response data:', data);
-        
-        if (data.success) {
-          console.log('✓ Login successful!');
-          console.log('Token (partial):', data.token);
-          message.textContent = '✓ Login successful! Loading dashboard...';
-          message.className = 'success';
-          
-          // Check if cookies are enabled
-          document.cookie = "test=1";
-          const cookiesEnabled = document.cookie.indexOf("test=") !== -1;
-          console.log('Cookies enabled:', cookiesEnabled);
-          
-          // Increased timeout to 1500ms for better reliability
-          console.log('Waiting 1500ms for cookie to be set...');
-          setTimeout(function() {
-            console.log('Current cookies:', document.cookie);
-            console.log('Redirecting to /dashboard now...');
-            window.location.href = '/dashboard';
-          }, 1500);
-        } else {
-          console.log('✗ Login failed:', data.message);
-          message.textContent = '✗ ' + (data.message || 'Invalid credentials');
-          message.className = 'error';
-        }
-      })
-      .catch(error => {
-        console.error('Login error:', error);
-        message.textContent = '✗ Connection error: ' + error.message;
-        message.className = 'error';
-      });
-      
-      return false;
-    }
-    
-    console.log('Login page loaded successfully');
-    console.log('Cookies enabled:', navigator.cookieEnabled);
-  </script>
-</body>
-</html>
-)rawliteral";
-
-  server.send(200, "text/html", html);
-  Serial.println("[WEB] Login page sent");
+  sendGzipAsset(LOGIN_HTML_GZ, LOGIN_HTML_GZ_LEN, LOGIN_HTML_ETAG);
 }
 
 void handleLogin() {
-  Serial.println("\n[WEB] ========== LOGIN REQUEST ==========");
-  Serial.println("[WEB] Method: " + String(server.method() == HTTP_POST ? "POST" : "GET"));
-  Serial.println("[WEB] URI: " + server.uri());
-  
   if (!server.hasArg("username") || !server.hasArg("password")) {
-    Serial.println("[WEB] ERROR: Missing credentials");
+    LOG_W("WEB", "Login without credentials");
     server.send(400, "application/json", "{\"success\":false,\"message\":\"Missing credentials\"}");
     return;
   }
@@ -413,358 +240,367 @@ void handleLogin() {
   String username = server.arg("username");
   String password = server.arg("password");
   
-  Serial.println("[WEB] Username: " + username);
-  Serial.println("[WEB] Password length: " + String(password.length()));
-  Serial.println("[WEB] Attempting authentication...");
-  
   User* user = authenticateUser(username, password);
   
   if (user != nullptr) {
-    Serial.println("[WEB] ✓ Authentication SUCCESSFUL!");
-    Serial.println("[WEB] User role: " + String(getRoleName(user->role)));
+    char token[SESSION_TOKEN_HEX_LEN + 1];
+    sessions.create(username.c_str(), user->role, millis(), token);
+    LOG_I("WEB", "✓ Login %s as %s (%u sessions)", username.c_str(), getRoleName(user->role), (unsigned)sessions.count());
     
-    String token = createSession(username, user->role);
-    Serial.println("[WEB] Token created: " + token.substring(0, 8) + "...");
-    Serial.println("[WEB] Full token: " + token);
-    
-    addLog(username, "Logged in as " + String(getRoleName(user->role)));
+    LogArgs args = {};
+    args.extra = user->role;
+    addLog(username.c_str(), LOG_LOGIN, args);
     
     // FIXED: Use space after semicolons (HTTP standard) and remove SameSite for compatibility
-    String cookie = "session=" + token + "; Path=/; Max-Age=3600; HttpOnly";
-    
-    Serial.println("[WEB] Setting cookie: " + cookie);
+    char cookie[80];
+    snprintf(cookie, sizeof(cookie), "session=%s; Path=/; Max-Age=%lu; HttpOnly", token, SESSION_TIMEOUT_MS / 1000);
     
     server.sendHeader("Set-Cookie", cookie);
     server.sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
     
-    String response = "{\"success\":true,\"role\":\"" + String(getRoleName(user->role)) + "\",\"token\":\"" + token.substring(0, 8) + "...\"}";
-    server.send(200, "application/json", response);
-    
-    Serial.println("[WEB] Response sent - Status: 200");
-    Serial.println("[WEB] Cookie should be set now");
-    Serial.println("[WEB] ========== LOGIN SUCCESS ==========\n");
+    ResponseWriter out(server);
+    out.begin(200, "application/json");
+    out.printf("{\"success\":true,\"role\":\"%s\",\"token\":\"%.8s...\"}", getRoleName(user->role), token);
+    out.end();
   } else {
-    Serial.println("[WEB] ✗ Authentication FAILED!");
+    LOG_W("WEB", "✗ Login failed for %s", username.c_str());
     server.send(401, "application/json", "{\"success\":false,\"message\":\"Invalid username or password\"}");
-    Serial.println("[WEB] ========== LOGIN FAILED ==========\n");
   }
 }
 
 void handleDashboard() {
-  Serial.println("\n[WEB] ========== DASHBOARD REQUEST ==========");
-  Serial.println("[WEB] Method: " + String(server.method() == HTTP_GET ? "GET" : "POST"));
-  Serial.println("[WEB] URI: " + server.uri());
-  
-  // Debug all headers
-  Serial.println("[WEB] Headers received:");
-  for (int i = 0; i < server.headers(); i++) {
-    Serial.println("  " + server.headerName(i) + ": " + server.header(i));
-  }
-  
-  Session* session = getSessionFromRequest();
-  
-  if (session == nullptr) {
-    Serial.println("[WEB] ✗ No valid session found");
-    Serial.println("[WEB] Redirecting to login page");
-    
-    String redirectHtml = "<!DOCTYPE html><html><head>"
-                         "<meta http-equiv=\"refresh\" content=\"0;url=/\">"
-                         "</head><body>Redirecting to login...</body></html>";
-    
-    server.send(200, "text/html", redirectHtml);
-    Serial.println("[WEB] ========================================\n");
-    return;
-  }
-  
-  Serial.println("[WEB] ✓ Valid session found!");
-  Serial.println("[WEB] Username: " + session->username);
-  Serial.println("[WEB] Role: " + String(getRoleName(session->role)));
-  Serial.println("[WEB] Building dashboard HTML...");
+  LOG_D("WEB", "Dashboard for %s (%s)", requestSession->username, getRoleName(requestSession->role));
   
+  // The page is static; per-user data is fetched from /api/session
+  sendGzipAsset(DASHBOARD_HTML_GZ, DASHBOARD_HTML_GZ_LEN, DASHBOARD_HTML_ETAG);
+}
+
+// Bootstrap data for the dashboard: who is logged in and what they may do
+void handleSessionInfo() {
+  Session* session = requestSession;
   Permissions perms = getPermissions(session->role);
-  String roleName = getRoleName(session->role);
-  String roleClass = session->role == ADMIN ? "admin" : session->role == MODERATOR ? "moderator" : session->role == VIEWER ? "viewer" : "guest";
-  
-  String html = "<!DOCTYPE html><html><head><meta charset=\"UTF-8\"><meta name=\"viewport\" content=\"width=device-width, initial-scale=1.0\"><title>ESP32 LED Dashboard</title><style>*{margin:0;padding:0;box-sizing:border-box}body{font-family:Arial;background:#1a1a1a;color:white;padding:20px}.container{max-width:1200px;margin:0 auto}.header{display:flex;justify-content:space-between;align-items:center;margin-bottom:20px;padding:20px;background:#2a2a2a;border-radius:10px}.user-info{display:flex;align-items:center;gap:15px}.username{font-size:20px;font-weight:bold;color:#4CAF50}.role-badge{padding:6px 16px;border-radius:15px;font-size:13px;font-weight:bold}.role-badge.admin{background:#ff5722}.role-badge.moderator{background:#ff9800}.role-badge.viewer{background:#2196F3}.role-badge.guest{background:#9e9e9e}.logout-btn{padding:10px 20px;background:#f44336;color:white;border:none;border-radius:5px;cursor:pointer}.grid{display:grid;grid-template-columns:repeat(auto-fit,minmax(300px,1fr));gap:20px;margin-bottom:20px}.card{background:#2a2a2a;border-radius:10px;padding:20px}.card h2{margin-bottom:15px;font-size:18px;color:#4CAF50}#ledPreview{width:120px;height:120px;margin:20px auto;border-radius:50%;border:4px solid #666;transition:all 0.3s;background:#333}.led-info{text-align:center;margin-top:15px;font-size:14px;color:#aaa}.led-info div{margin:5px 0}.button{padding:12px 25px;margin:5px;font-size:16px;cursor:pointer;border-radius:5px;border:none;transition:transform 0.1s;font-weight:500}.button:active{transform:scale(0.95)}.button:disabled{opacity:0.4;cursor:not-allowed}.on{background-color:#4CAF50;color:white}.off{background-color:#f44336;color:white}.color{background-color:#2196F3;color:white}.controls-grid{display:grid;grid-template-columns:repeat(auto-fit,minmax(140px,1fr));gap:10px}#status{margin-top:15px;font-size:14px;padding:12px;background:#333;border-radius:5px;text-align:center}.access-denied{color:#ff9800;font-style:italic;text-align:center;padding:20px;background:rgba(255,152,0,0.1);border-radius:5px}.permissions-list{list-style:none;padding:0}.permissions-list li{padding:8px 0;border-bottom:1px solid #333;display:flex;align-items:center;gap:10px}.permissions-list li:last-child{border-bottom:none}#activityLog{max-height:300px;overflow-y:auto;font-size:13px}.log-entry{padding:8px;margin:5px 0;background:#1a1a1a;border-radius:5px;border-left:3px solid #4CAF50}.log-time{color:#888;font-size:11px}.log-user{color:#4CAF50;font-weight:bold}</style></head><body><div class=\"container\"><div class=\"header\"><div class=\"user-info\"><span class=\"username\">" + session->username + "</span><span class=\"role-badge " + roleClass + "\">" + roleName + "</span></div><button class=\"logout-btn\" onclick=\"logout()\">Logout</button></div><div class=\"grid\"><div class=\"card\"><h2>💡 LED Status</h2><div id=\"ledPreview\"></div><div class=\"led-info\"><div>State: <span id=\"ledStateText\">Loading...</span></div><div>RGB: <span id=\"ledRGB\">-</span></div></div></div><div class=\"card\"><h2>🔐 Permissions</h2><ul class=\"permissions-list\"><li>" + String(perms.canControlLED ? "✅" : "❌") + " Control LED</li><li>" + String(perms.canViewStatus ? "✅" : "❌") + " View Status</li><li>" + String(perms.canViewLogs ? "✅" : "❌") + " View Logs</li><li>" + String(perms.canChangeSettings ? "✅" : "❌") + " Settings</li><li>" + String(perms.canAccessAPI ? "✅" : "❌") + " API Access</li></ul></div></div><div class=\"card\" style=\"margin-bottom:20px\"><h2>🎮 LED Controls</h2>";
-  
-  if (perms.canControlLED) {
-    html += "<div class=\"controls-grid\"><button class=\"button on\" onclick=\"ledControl('on')\">ON</button><button class=\"button off\" onclick=\"ledControl('off')\">OFF</button><button class=\"button color\" onclick=\"ledControl('red')\">Red</button><button class=\"button color\" onclick=\"ledControl('green')\">Green</button><button class=\"button color\" onclick=\"ledControl('blue')\">Blue</button><button class=\"button color\" onclick=\"ledControl('white')\">White</button><button class=\"button color\" onclick=\"ledControl('yellow')\">Yellow</button><button class=\"button color\" onclick=\"ledControl('cyan')\">Cyan</button><button class=\"button color\" onclick=\"ledControl('magenta')\">Magenta</button></div>";
-  } else {
-    html += "<div class=\"access-denied\">🔒 LED control requires Admin or Moderator privileges. Current role: " + roleName + "</div>";
-  }
-  
-  html += "<div id=\"status\">Ready</div></div>";
-  
-  if (session->role == ADMIN) {
-    html += "<div class=\"card\" style=\"margin-bottom:20px\"><h2>🔔 Buzzer Control (Admin Only)</h2><div class=\"controls-grid\"><button class=\"button on\" onclick=\"buzzerControl('on')\">Buzzer ON</button><button class=\"button off\" onclick=\"buzzerControl('off')\">Buzzer OFF</button><button class=\"button color\" onclick=\"buzzerControl('beep')\">🔊 Beep</button></div><div id=\"buzzerStatus\" style=\"margin-top:10px;font-size:14px;padding:10px;background:#333;border-radius:5px;text-align:center\">Ready</div></div>";
+  const char* roleClass = session->role == ADMIN ? "admin" : session->role == MODERATOR ? "moderator" : session->role == VIEWER ? "viewer" : "guest";
+
+  server.sendHeader("Cache-Control", "no-store");
+  ResponseWriter out(server);
+  out.begin(200, "application/json");
+  out.print("{\"username\":");
+  out.printJsonString(session->username);
+  out.printf(",\"role\":\"%s\",\"roleClass\":\"%s\",\"isAdmin\":%s,",
+             getRoleName(session->role), roleClass, session->role == ADMIN ? "true" : "false");
+  out.printf("\"perms\":{\"controlLED\":%s,\"viewStatus\":%s,\"viewLogs\":%s,\"changeSettings\":%s,\"accessAPI\":%s}}",
+             perms.canControlLED ? "true" : "false",
+             perms.canViewStatus ? "true" : "false",
+             perms.canViewLogs ? "true" : "false",
+             perms.canChangeSettings ? "true" : "false",
+             perms.canAccessAPI ? "true" : "false");
+  out.end();
+}
+
+// Entries go out a few per call as the client reads; any logged meanwhile
+// are included and "next" covers them
+static bool produceLogs(HttpServer& out, HttpServer::StreamCursor& cursor) {
+  char entry[160];
+  while (cursor.next < activityLog.nextSeq()) {
+    if (cursor.next < activityLog.firstSeq()) {
+      // Overwritten since the last call
+      if (cursor.next == cursor.start) {
+        cursor.start = activityLog.firstSeq();
+      }
+      cursor.next = activityLog.firstSeq();
+    }
+    if (out.room() < sizeof(entry)) {
+      return true;
+    }
+    bool first = cursor.next == cursor.start;
+    entry[0] = ',';
+    int n = formatLogJson(*activityLog.get(cursor.next), cursor.next, entry + 1, sizeof(entry) - 1);
+    if (n >= (int)sizeof(entry) - 1) {
+      n = sizeof(entry) - 2;
+    }
+    out.sendContent(first ? entry + 1 : entry, first ? n : n + 1);
+    cursor.next++;
   }
-  
-  if (perms.canViewLogs) {
-    html += "<div class=\"card\"><h2>📋 Activity Log</h2><div id=\"activityLog\">Loading...</div></div>";
+  char tail[32];
+  int n = snprintf(tail, sizeof(tail), "],\"next\":%lu}", (unsigned long)activityLog.nextSeq());
+  if (out.room() < (size_t)n) {
+    return true;
   }
-  
-  html += "</div><script>const canControl=" + String(perms.canControlLED ? "true" : "false") + ";const canViewLogs=" + String(perms.canViewLogs ? "true" : "false") + ";const isAdmin=" + String(session->role == ADMIN ? "true" : "false") + ";function ledControl(c){if(!canControl){document.getElementById('status').innerHTML='🔒 Access Denied';return}document.getElementById('status').innerHTML='⏳ '+c;fetch('/led/'+c).then(r=>{if(r.status===403)throw new Error('Access Denied');if(!r.ok)throw new Error('HTTP '+r.status);return r.text()}).then(d=>{document.getElementById('status').innerHTML='✓ '+d;setTimeout(updateStatus,100)}).catch(e=>{document.getElementById('status').innerHTML='✗ '+e.message})}function buzzerControl(c){if(!isAdmin){document.getElementById('buzzerStatus').innerHTML='🔒 Access Denied';return}document.getElementById('buzzerStatus').innerHTML='⏳ Controlling buzzer...';fetch('/buzzer/'+c).then(r=>{if(r.status===403)throw new Error('Access Denied');if(!r.ok)throw new Error('HTTP '+r.status);return r.text()}).then(d=>{document.getElementById('buzzerStatus').innerHTML='✓ '+d}).catch(e=>{document.getElementById('buzzerStatus').innerHTML='✗ '+e.message})}function updateStatus(){fetch('/status').then(r=>r.json()).then(d=>{let p=document.getElementById('ledPreview');let s=document.getElementById('ledStateText');let rgb=document.getElementById('ledRGB');if(d.state==='on'){p.style.backgroundColor='rgb('+d.red+','+d.green+','+d.blue+')';p.style.boxShadow='0 0 40px rgba('+d.red+','+d.green+','+d.blue+',0.8)';s.textContent='ON';s.style.color='#4CAF50'}else{p.style.backgroundColor='#333';p.style.boxShadow='none';s.textContent='OFF';s.style.color='#f44336'}rgb.textContent='('+d.red+','+d.green+','+d.blue+')'}).catch(e=>console.error(e))}function updateLogs(){if(!canViewLogs)return;fetch('/logs').then(r=>r.json()).then(d=>{const logDiv=document.getElementById('activityLog');if(d.logs&&d.logs.length>0){logDiv.innerHTML=d.logs.map(log=>`<div class=\"log-entry\"><div class=\"log-time\">${log.timestamp}</div><div><span class=\"log-user\">${log.username}</span>: ${log.action}</div></div>`).join('')}else{logDiv.innerHTML='<div style=\"text-align:center;color:#888;padding:20px\">No activity</div>'}}).catch(e=>console.error(e))}function logout(){fetch('/logout').then(()=>window.location.href='/').catch(()=>window.location.href='/')}setInterval(updateStatus,1000);if(canViewLogs){setInterval(updateLogs,5000);updateLogs()}updateStatus();console.log('Dashboard loaded for user')</script></body></html>";
-  
-  server.send(200, "text/html", html);
-  Serial.println("[WEB] Dashboard sent");
-  Serial.println("[WEB] ========================================\n");
+  out.sendContent(tail, n);
+  return false;
 }
 
 void handleLogs() {
-  Session* session = getSessionFromRequest();
-  if (session == nullptr) {
-    server.send(401, "application/json", "{\"error\":\"Not authenticated\"}");
-    return;
-  }
-  
-  Permissions perms = getPermissions(session->role);
-  if (!perms.canViewLogs) {
-    server.send(403, "application/json", "{\"error\":\"Insufficient privileges\"}");
-    return;
-  }
-  
-  String json = "{\"logs\":[";
-  bool first = true;
-  
-  for (int i = 0; i < 50; i++) {
-    int idx = (logIndex + i) % 50;
-    if (activityLogs[idx].username.length() > 0) {
-      if (!first) json += ",";
-      json += "{\"timestamp\":\"" + activityLogs[idx].timestamp + "\",\"username\":\"" + activityLogs[idx].username + "\",\"action\":\"" + activityLogs[idx].action + "\"}";
-      first = false;
-    }
-  }
-  
-  json += "]}";
-  server.send(200, "application/json", json);
+  // ?since=<seq> returns only entries from that sequence on; the reply's
+  // "next" is the value to pass on the following poll
+  uint32_t since = server.hasArg("since") ? strtoul(server.arg("since").c_str(), nullptr, 10) : 0;
+  if (since < activityLog.firstSeq()) {
+    since = activityLog.firstSeq();
+  }
+  server.sendStream(200, "application/json", produceLogs, since);
+  server.sendContent("{\"logs\":[", 9);
 }
 
 void handleLogout() {
-  Session* session = getSessionFromRequest();
-  if (session != nullptr) {
-    addLog(session->username, "Logged out");
-    session->token = "";
+  if (requestSession != nullptr) {
+    closeEventClientsFor(requestSession);
+    addLog(requestSession->username, LOG_LOGOUT);
+    sessions.remove(requestSession);
+    requestSession = nullptr;
   }
   server.sendHeader("Set-Cookie", "session=;Path=/;Max-Age=0");
   server.sendHeader("Location", "/");
   server.send(302, "text/html", "");
 }
 
-void handleLEDOn() {
-  Session* session = getSessionFromRequest();
-  if (session == nullptr) {
-    server.send(401, "text/plain", "Not authenticated");
+// /led/{command} - on, off or one of the named colors of the MQTT LED table
+void handleLEDCommand() {
+  const char* name = server.pathArg(0);
+  const TableEntry* cmd = lookupLEDCommand(name, strlen(name));
+  if (cmd == nullptr) {
+    server.send(404, "text/plain", "Unknown LED command");
     return;
   }
-  
-  Permissions perms = getPermissions(session->role);
-  if (!perms.canControlLED) {
-    server.send(403, "text/plain", "Access Denied");
-    return;
-  }
-  
-  if (ledState.red == 0 && ledState.green == 0 && ledState.blue == 0) {
-    setLED(true, 255, 255, 255);
-  } else {
-    setLED(true, ledState.red, ledState.green, ledState.blue);
-  }
-  addLog(session->username, "LED turned ON");
-  server.send(200, "text/plain", "LED turned ON");
-}
 
-void handleLEDOff() {
-  Session* session = getSessionFromRequest();
-  if (session == nullptr) {
-    server.send(401, "text/plain", "Not authenticated");
-    return;
-  }
-  
-  Permissions perms = getPermissions(session->role);
-  if (!perms.canControlLED) {
-    server.send(403, "text/plain", "Access Denied");
-    return;
+  char msg[32];
+  switch (cmd->id) {
+    case LED_CMD_ON:
+      turnLEDOn();
+      addLog(requestSession->username, LOG_LED_ON);
+      snprintf(msg, sizeof(msg), "LED turned ON");
+      break;
+    case LED_CMD_OFF:
+      setLED(false, 0, 0, 0);
+      addLog(requestSession->username, LOG_LED_OFF);
+      snprintf(msg, sizeof(msg), "LED turned OFF");
+      break;
+    default:
+      setLED(true, cmd->r, cmd->g, cmd->b);
+      addLog(requestSession->username, LOG_LED_COLOR, LogArgs{cmd->r, cmd->g, cmd->b, 0, 0, 0});
+      int n = snprintf(msg, sizeof(msg), "LED set to ");
+      for (const char* c = name; *c != '\0' && n < (int)sizeof(msg) - 1; c++) {
+        msg[n++] = toupper(*c);
+      }
+      msg[n] = '\0';
+      break;
   }
-  
-  setLED(false, 0, 0, 0);
-  addLog(session->username, "LED turned OFF");
-  server.send(200, "text/plain", "LED turned OFF");
+  server.send(200, "text/plain", msg);
 }
 
-void handleRed() {
-  Session* session = getSessionFromRequest();
-  if (session == nullptr || !getPermissions(session->role).canControlLED) {
-    server.send(403, "text/plain", "Access Denied");
-    return;
+// /led?r=&g=&b=[&br=][&start=&count=|&segment=][&effect=&ms=] - color a
+// range of pixels, optionally as an effect (fade, breathe, chase, rainbow,
+// none). br alone only changes the brightness.
+void handleLEDRange() {
+  Session* session = requestSession;
+
+  if (server.hasArg("br")) {
+    uint8_t br = constrain(server.arg("br").toInt(), 0, 255);
+    setLEDBrightness(br);
+    addLog(session->username, LOG_LED_BRIGHTNESS, LogArgs{0, 0, 0, br, 0, 0});
+    if (!server.hasArg("r") && !server.hasArg("g") && !server.hasArg("b") && !server.hasArg("effect") &&
+        !server.hasArg("segment") && !server.hasArg("start") && !server.hasArg("count") && !server.hasArg("ms")) {
+      char msg[32];
+      snprintf(msg, sizeof(msg), "Brightness set to %u", br);
+      server.send(200, "text/plain", msg);
+      return;
+    }
   }
-  setLED(true, 255, 0, 0);
-  addLog(session->username, "LED set to RED");
-  server.send(200, "text/plain", "LED set to RED");
-}
 
-void handleGreen() {
-  Session* session = getSessionFromRequest();
-  if (session == nullptr || !getPermissions(session->role).canControlLED) {
-    server.send(403, "text/plain", "Access Denied");
-    return;
-  }
-  setLED(true, 0, 255, 0);
-  addLog(session->username, "LED set to GREEN");
-  server.send(200, "text/plain", "LED set to GREEN");
-}
+  uint8_t r = server.hasArg("r") ? constrain(server.arg("r").toInt(), 0, 255) : ledState.red;
+  uint8_t g = server.hasArg("g") ? constrain(server.arg("g").toInt(), 0, 255) : ledState.green;
+  uint8_t b = server.hasArg("b") ? constrain(server.arg("b").toInt(), 0, 255) : ledState.blue;
 
-void handleBlue() {
-  Session* session = getSessionFromRequest();
-  if (session == nullptr || !getPermissions(session->role).canControlLED) {
-    server.send(403, "text/plain", "Access Denied");
-    return;
+  uint16_t start = 0;
+  uint16_t count = frame.size();
+  if (server.hasArg("segment")) {
+    long id = server.arg("segment").toInt();
+    if (id < 0 || id > 0xFF) {
+      server.send(400, "text/plain", "Bad segment");
+      return;
+    }
+    const Segment* seg = frame.segment((uint8_t)id);
+    if (seg == nullptr) {
+      server.send(404, "text/plain", "Unknown segment");
+      return;
+    }
+    start = seg->start;
+    count = seg->count;
+  } else {
+    if (server.hasArg("start")) {
+      start = constrain(server.arg("start").toInt(), 0, 0xFFFF);
+    }
+    if (server.hasArg("count")) {
+      count = constrain(server.arg("count").toInt(), 0, 0xFFFF);
+    }
   }
-  setLED(true, 0, 0, 255);
-  addLog(session->username, "LED set to BLUE");
-  server.send(200, "text/plain", "LED set to BLUE");
-}
 
-void handleWhite() {
-  Session* session = getSessionFromRequest();
-  if (session == nullptr || !getPermissions(session->role).canControlLED) {
-    server.send(403, "text/plain", "Access Denied");
+  if (count == 0) {
+    server.send(400, "text/plain", "Empty range");
     return;
   }
-  setLED(true, 255, 255, 255);
-  addLog(session->username, "LED set to WHITE");
-  server.send(200, "text/plain", "LED set to WHITE");
-}
-
-void handleYellow() {
-  Session* session = getSessionFromRequest();
-  if (session == nullptr || !getPermissions(session->role).canControlLED) {
-    server.send(403, "text/plain", "Access Denied");
+  if (start >= frame.size()) {
+    server.send(400, "text/plain", "Range outside the strip");
     return;
   }
-  setLED(true, 255, 255, 0);
-  addLog(session->username, "LED set to YELLOW");
-  server.send(200, "text/plain", "LED set to YELLOW");
-}
-
-void handleCyan() {
-  Session* session = getSessionFromRequest();
-  if (session == nullptr || !getPermissions(session->role).canControlLED) {
-    server.send(403, "text/plain", "Access Denied");
-    return;
+  if (count > frame.size() - start) {
+    count = frame.size() - start;
   }
-  setLED(true, 0, 255, 255);
-  addLog(session->username, "LED set to CYAN");
-  server.send(200, "text/plain", "LED set to CYAN");
-}
 
-void handleMagenta() {
-  Session* session = getSessionFromRequest();
-  if (session == nullptr || !getPermissions(session->role).canControlLED) {
-    server.send(403, "text/plain", "Access Denied");
-    return;
+  char msg[64];
+  long msArg = server.hasArg("ms") ? server.arg("ms").toInt() : 0;
+  uint32_t ms = msArg > 0 ? (uint32_t)msArg : 0;
+  if (server.hasArg("effect")) {
+    String name = server.arg("effect");
+    uint8_t type = lookupEffect(name.c_str(), name.length());
+    if (type == EFFECT_NONE) {
+      FrameLock lock;
+      cancelEffect();
+    } else {
+      startLEDEffect(type, start, count, r, g, b, ms);
+    }
+    snprintf(msg, sizeof(msg), "Effect %s on pixels %u-%u", name.c_str(), start, start + count - 1);
+    addLog(session->username, LOG_LED_EFFECT, LogArgs{r, g, b, type, start, count});
+  } else {
+    if (ms > 0) {
+      startLEDEffect(EFFECT_FADE, start, count, r, g, b, ms);
+    } else {
+      setLEDRange(start, count, r, g, b);
+    }
+    snprintf(msg, sizeof(msg), "Pixels %u-%u set to #%02X%02X%02X", start, start + count - 1, r, g, b);
+    addLog(session->username, LOG_LED_RANGE, LogArgs{r, g, b, 0, start, count});
   }
-  setLED(true, 255, 0, 255);
-  addLog(session->username, "LED set to MAGENTA");
-  server.send(200, "text/plain", "LED set to MAGENTA");
+  server.send(200, "text/plain", msg);
 }
 
 void handleBuzzerOn() {
-  Session* session = getSessionFromRequest();
-  if (session == nullptr) {
-    server.send(401, "text/plain", "Not authenticated");
-    return;
-  }
-  
-  if (session->role != ADMIN) {
-    server.send(403, "text/plain", "Access Denied: Admin only");
-    return;
-  }
-  
+  Session* session = requestSession;
   digitalWrite(PIN_BUZZER, HIGH);
-  addLog(session->username, "Buzzer turned ON");
+  addLog(session->username, LOG_BUZZER_ON);
   server.send(200, "text/plain", "Buzzer turned ON");
-  Serial.println("[BUZZER] Turned ON by " + session->username);
+  LOG_I("BUZZER", "Turned ON by %s", session->username);
 }
 
 void handleBuzzerOff() {
-  Session* session = getSessionFromRequest();
-  if (session == nullptr) {
-    server.send(401, "text/plain", "Not authenticated");
-    return;
-  }
-  
-  if (session->role != ADMIN) {
-    server.send(403, "text/plain", "Access Denied: Admin only");
-    return;
-  }
-  
+  Session* session = requestSession;
   digitalWrite(PIN_BUZZER, LOW);
-  addLog(session->username, "Buzzer turned OFF");
+  addLog(session->username, LOG_BUZZER_OFF);
   server.send(200, "text/plain", "Buzzer turned OFF");
-  Serial.println("[BUZZER] Turned OFF by " + session->username);
+  LOG_I("BUZZER", "Turned OFF by %s", session->username);
 }
 
 void handleBuzzerBeep() {
-  Session* session = getSessionFromRequest();
-  if (session == nullptr) {
-    server.send(401, "text/plain", "Not authenticated");
-    return;
-  }
-  
-  if (session->role != ADMIN) {
-    server.send(403, "text/plain", "Access Denied: Admin only");
-    return;
-  }
-  
-  digitalWrite(PIN_BUZZER, HIGH);
-  delay(200);
-  digitalWrite(PIN_BUZZER, LOW);
-  addLog(session->username, "Buzzer beeped");
+  Session* session = requestSession;
+  buzz(200);
+  addLog(session->username, LOG_BUZZER_BEEP);
   server.send(200, "text/plain", "Buzzer beeped");
-  Serial.println("[BUZZER] Beeped by " + session->username);
+  LOG_I("BUZZER", "Beeped by %s", session->username);
 }
 
 void handleStatus() {
-  Session* session = getSessionFromRequest();
-  if (session == nullptr) {
-    server.send(401, "application/json", "{\"error\":\"Not authenticated\"}");
-    return;
-  }
-  
-  String json = "{\"state\":\"" + String(ledState.isOn ? "on" : "off") + "\",\"red\":" + String(ledState.red) + ",\"green\":" + String(ledState.green) + ",\"blue\":" + String(ledState.blue) + ",\"brightness\":" + String(ledState.brightness) + "}";
+  char json[120];
+  formatLEDStateJson(json, sizeof(json));
   server.send(200, "application/json", json);
 }
 
+// Scraped by the monitoring stack, which holds no session; it exposes
+// timings and counters only, no device state
+void handleMetrics() {
+  writePrometheusMetrics(server);
+}
+
 void handleNotFound() {
-  Serial.println("[WEB] 404: " + server.uri());
+  LOG_D("WEB", "404: %s", server.uri().c_str());
   server.send(404, "text/plain", "404: Not Found");
 }
 
+// ========================================
+// Routing and access control
+// ========================================
+// Every route names the access it needs; authorize() runs before the
+// handler, resolves the session once and answers 401/403 itself, so
+// handlers can rely on requestSession being set.
+enum Access : uint8_t {
+  ACCESS_PUBLIC,       // anyone, requestSession may be nullptr
+  ACCESS_PAGE,         // logged in, otherwise redirected to the login page
+  ACCESS_SESSION,      // logged in
+  ACCESS_VIEW_STATUS,
+  ACCESS_VIEW_LOGS,
+  ACCESS_CONTROL_LED,
+  ACCESS_ADMIN
+};
+
+struct RouteSpec {
+  const char* uri;
+  HTTPMethod method;
+  Access access;
+  HttpServer::Handler handler;
+};
+
+constexpr RouteSpec ROUTES[] = {
+  {"/",            HTTP_GET,  ACCESS_PUBLIC,      handleRoot},
+  {"/login",       HTTP_POST, ACCESS_PUBLIC,      handleLogin},
+  {"/logout",      HTTP_GET,  ACCESS_PUBLIC,      handleLogout},
+  {"/dashboard",   HTTP_GET,  ACCESS_PAGE,        handleDashboard},
+  {"/api/session", HTTP_GET,  ACCESS_SESSION,     handleSessionInfo},
+  {"/logs",        HTTP_GET,  ACCESS_VIEW_LOGS,   handleLogs},
+  {"/status",      HTTP_GET,  ACCESS_VIEW_STATUS, handleStatus},
+  {"/metrics",     HTTP_GET,  ACCESS_PUBLIC,      handleMetrics},
+  {"/events",      HTTP_GET,  ACCESS_SESSION,     handleEvents},
+  {"/led",         HTTP_GET,  ACCESS_CONTROL_LED, handleLEDRange},
+  {"/led/{cmd}",   HTTP_GET,  ACCESS_CONTROL_LED, handleLEDCommand},
+  {"/buzzer/on",   HTTP_GET,  ACCESS_ADMIN,       handleBuzzerOn},
+  {"/buzzer/off",  HTTP_GET,  ACCESS_ADMIN,       handleBuzzerOff},
+  {"/buzzer/beep", HTTP_GET,  ACCESS_ADMIN,       handleBuzzerBeep},
+};
+
+static_assert(sizeof(ROUTES) / sizeof(ROUTES[0]) <= HttpServer::MAX_ROUTES, "Raise HttpServer::MAX_ROUTES");
+
+bool hasAccess(UserRole role, Access access) {
+  Permissions perms = getPermissions(role);
+  switch (access) {
+    case ACCESS_VIEW_STATUS: return perms.canViewStatus;
+    case ACCESS_VIEW_LOGS: return perms.canViewLogs;
+    case ACCESS_CONTROL_LED: return perms.canControlLED;
+    case ACCESS_ADMIN: return role == ADMIN;
+    default: return true;
+  }
+}
+
+bool authorize(uint8_t tag) {
+  Access access = (Access)tag;
+  requestSession = getSessionFromRequest();
+  if (access == ACCESS_PUBLIC) {
+    return true;
+  }
+
+  if (requestSession == nullptr) {
+    if (access == ACCESS_PAGE) {
+      LOG_D("WEB", "%s without session, redirecting to login", server.path());
+      server.sendHeader("Location", "/");
+      server.send(302, "text/html", "");
+    } else {
+      server.send(401, "application/json", "{\"error\":\"Not authenticated\"}");
+    }
+    return false;
+  }
+
+  if (!hasAccess(requestSession->role, access)) {
+    LOG_D("WEB", "403: %s for %s", server.path(), requestSession->username);
+    server.send(403, "application/json", "{\"error\":\"Insufficient privileges\"}");
+    return false;
+  }
+  return true;
+}
+
 void setupWebServer() {
   Serial.println("\n========================================");
   Serial.println("Setting up Web Server with RBAC:");
   Serial.println("========================================");
   
-  server.on("/", HTTP_GET, handleRoot);
-  server.on("/login", HTTP_POST, handleLogin);
-  server.on("/logout", HTTP_GET, handleLogout);
-  server.on("/dashboard", HTTP_GET, handleDashboard);
-  server.on("/logs", HTTP_GET, handleLogs);
-  
-  server.on("/led/on", HTTP_GET, handleLEDOn);
-  server.on("/led/off", HTTP_GET, handleLEDOff);
-  server.on("/led/red", HTTP_GET, handleRed);
-  server.on("/led/green", HTTP_GET, handleGreen);
-  server.on("/led/blue", HTTP_GET, handleBlue);
-  server.on("/led/white", HTTP_GET, handleWhite);
-  server.on("/led/yellow", HTTP_GET, handleYellow);
-  server.on("/led/cyan", HTTP_GET, handleCyan);
-  server.on("/led/magenta", HTTP_GET, handleMagenta);
-  
-  server.on("/buzzer/on", HTTP_GET, handleBuzzerOn);
-  server.on("/buzzer/off", HTTP_GET, handleBuzzerOff);
-  server.on("/buzzer/beep", HTTP_GET, handleBuzzerBeep);
-  
-  server.on("/status", HTTP_GET, handleStatus);
+  for (const RouteSpec& r : ROUTES) {
+    server.on(r.uri, r.method, r.handler, r.access);
+  }
+  server.use(authorize);
   server.onNotFound(handleNotFound);
   
   server.begin();
@@ -778,30 +614,8 @@ void setupWebServer() {
   Serial.println("  Viewer: viewer/view123 - View Only");
   Serial.println("  Guest: guest/guest123 - Limited View");
   Serial.println("========================================\n");
-  const char* headerKeys[] = {"Cookie"};
-server.collectHeaders(headerKeys, 1);
-}
-
-void cleanExpiredSessions() {
-  static unsigned long lastCleanup = 0;
-  
-  if (millis() - lastCleanup > 300000) {
-    Serial.println("[SESSION] Cleaning expired sessions...");
-    
-    int cleaned = 0;
-    for (int i = 0; i < 10; i++) {
-      if (activeSessions[i].token.length() > 0) {
-        if (millis() - activeSessions[i].loginTime > SESSION_TIMEOUT) {
-          Serial.println("[SESSION] Removing expired session for: " + activeSessions[i].username);
-          activeSessions[i].token = "";
-          cleaned++;
-        }
-      }
-    }
-    
-    Serial.println("[SESSION] Cleaned " + String(cleaned) + " expired sessions");
-    lastCleanup = millis();
-  }
+  const char* headerKeys[] = {"Cookie", "If-None-Match"};
+  server.collectHeaders(headerKeys, 2);
 }
 
 bool controlLED(User user, bool turnOn) {
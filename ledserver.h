@@ -1,10 +1,12 @@
 #ifndef LEDSERVER_H
 #define LEDSERVER_H
 
-#include <WebServer.h>
+#include "httpserver.h"
 
-extern WebServer server;
+extern HttpServer server;
 
 void setupWebServer();
+void handleEventClients();
+void notifyLEDStateChanged();
 
 #endif
\ No newline at end of file
@@ -0,0 +1,29 @@
+#ifndef LEDSTATE_H
+#define LEDSTATE_H
+
+#include <stdint.h>
+#include "framebuffer.h"
+
+// Output state of the strip. Pixel contents live in `frame`; turning the
+// strip off blanks the output but keeps the frame, so "on" restores it.
+struct LEDState {
+  bool isOn;
+  uint8_t red;    // last solid color written, used for status and "on"
+  uint8_t green;
+  uint8_t blue;
+  uint8_t brightness;
+  bool changed;   // loop() only: set by commands, cleared when the status is queued
+};
+
+extern LEDState ledState;
+extern FrameBuffer frame;
+
+void setLED(bool state, uint8_t r, uint8_t g, uint8_t b);
+bool setLEDRange(uint16_t start, uint16_t count, uint8_t r, uint8_t g, uint8_t b);
+bool setLEDSegment(uint8_t id, uint8_t r, uint8_t g, uint8_t b);
+void setLEDPower(bool on);
+void setLEDBrightness(uint8_t brightness);
+void turnLEDOn();
+bool startLEDEffect(uint8_t type, uint16_t start, uint16_t count, uint8_t r, uint8_t g, uint8_t b, uint32_t durationMs);
+
+#endif // LEDSTATE_H
@@ -0,0 +1,17 @@
+#ifndef LEDSTRIP_H
+#define LEDSTRIP_H
+
+#include <Adafruit_NeoPixel.h>
+#include "config.h"
+
+// Output driver behind `strip`, chosen by LED_DRIVER_RMT in config.h
+#if LED_DRIVER_RMT
+#include "ws2812driver.h"
+typedef WS2812Driver LEDStrip;
+#else
+typedef Adafruit_NeoPixel LEDStrip;
+#endif
+
+extern LEDStrip strip;
+
+#endif // LEDSTRIP_H
@@ -0,0 +1,107 @@
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <atomic>
+#include "log.h"
+
+static_assert((LOG_QUEUE_SLOTS & (LOG_QUEUE_SLOTS - 1)) == 0, "LOG_QUEUE_SLOTS must be a power of two");
+
+// Bounded multi-producer ring (Vyukov). Each slot's sequence says whose
+// turn it is: == ticket means free for that producer, == ticket + 1 means
+// filled and ready for the drain task.
+struct LogSlot {
+  std::atomic<uint32_t> sequence;
+  uint16_t length;
+  char text[LOG_LINE_MAX];
+};
+
+static LogSlot slots[LOG_QUEUE_SLOTS];
+static std::atomic<uint32_t> head(0);
+static uint32_t tail = 0;  // drain task only
+static std::atomic<uint32_t> dropped(0);
+static TaskHandle_t logTaskHandle = nullptr;
+
+static const char LEVEL_CHARS[] = "-EWIDV";
+
+static void initSlots() {
+  static bool done = false;
+  if (done) {
+    return;
+  }
+  for (uint32_t i = 0; i < LOG_QUEUE_SLOTS; i++) {
+    slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  done = true;
+}
+
+void logWrite(uint8_t level, const char* tag, const char* fmt, ...) {
+  initSlots();
+
+  uint32_t ticket = head.load(std::memory_order_relaxed);
+  LogSlot* slot;
+  for (;;) {
+    slot = &slots[ticket & (LOG_QUEUE_SLOTS - 1)];
+    int32_t diff = (int32_t)(slot->sequence.load(std::memory_order_acquire) - ticket);
+    if (diff == 0) {
+      if (head.compare_exchange_weak(ticket, ticket + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // Ring full: the drain task is behind
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    } else {
+      ticket = head.load(std::memory_order_relaxed);
+    }
+  }
+
+  int n = snprintf(slot->text, LOG_LINE_MAX, "%c [%s] ", LEVEL_CHARS[level <= LOG_LEVEL_VERBOSE ? level : 0], tag);
+  va_list args;
+  va_start(args, fmt);
+  int m = vsnprintf(slot->text + n, LOG_LINE_MAX - n - 1, fmt, args);
+  va_end(args);
+  n += m < 0 ? 0 : (m < LOG_LINE_MAX - n - 1 ? m : LOG_LINE_MAX - n - 2);
+  slot->text[n++] = '\n';
+  slot->length = n;
+
+  slot->sequence.store(ticket + 1, std::memory_order_release);
+}
+
+uint32_t logDropped() {
+  return dropped.load(std::memory_order_relaxed);
+}
+
+static bool drainOne() {
+  LogSlot& slot = slots[tail & (LOG_QUEUE_SLOTS - 1)];
+  if (slot.sequence.load(std::memory_order_acquire) != tail + 1) {
+    return false;
+  }
+  Serial.write((const uint8_t*)slot.text, slot.length);
+  slot.sequence.store(tail + LOG_QUEUE_SLOTS, std::memory_order_release);
+  tail++;
+  return true;
+}
+
+static void logTask(void*) {
+  uint32_t reportedDrops = 0;
+  for (;;) {
+    while (drainOne()) {
+    }
+    uint32_t drops = logDropped();
+    if (drops != reportedDrops) {
+      Serial.printf("W [LOG] %lu lines dropped\n", (unsigned long)(drops - reportedDrops));
+      reportedDrops = drops;
+    }
+    vTaskDelay(pdMS_TO_TICKS(LOG_FLUSH_INTERVAL_MS));
+  }
+}
+
+void logStart() {
+  initSlots();
+  if (logTaskHandle != nullptr) {
+    return;
+  }
+  xTaskCreate(logTask, "log", 3072, nullptr, LOG_TASK_PRIORITY, &logTaskHandle);
+}
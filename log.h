@@ -0,0 +1,61 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdint.h>
+#include "config.h"
+
+// Leveled logging. Calls below LOG_LEVEL (set in platformio.ini build
+// flags) compile to nothing; their arguments are never evaluated but are
+// still type-checked against the format. The rest are formatted
+// into a lock-free ring of fixed-size lines and written to the UART by a
+// low-priority task, so callers never wait on the serial port. When the
+// ring is full, lines are dropped and counted rather than blocking.
+//
+//   LOG_I("LED", "✓ Brightness %d", brightness);
+
+#define LOG_LEVEL_NONE    0
+#define LOG_LEVEL_ERROR   1
+#define LOG_LEVEL_WARN    2
+#define LOG_LEVEL_INFO    3
+#define LOG_LEVEL_DEBUG   4
+#define LOG_LEVEL_VERBOSE 5
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+void logStart();
+void logWrite(uint8_t level, const char* tag, const char* fmt, ...) __attribute__((format(printf, 3, 4)));
+uint32_t logDropped();
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_E(tag, ...) logWrite(LOG_LEVEL_ERROR, tag, __VA_ARGS__)
+#else
+#define LOG_E(tag, ...) do { if (0) logWrite(0, tag, __VA_ARGS__); } while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_W(tag, ...) logWrite(LOG_LEVEL_WARN, tag, __VA_ARGS__)
+#else
+#define LOG_W(tag, ...) do { if (0) logWrite(0, tag, __VA_ARGS__); } while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_I(tag, ...) logWrite(LOG_LEVEL_INFO, tag, __VA_ARGS__)
+#else
+#define LOG_I(tag, ...) do { if (0) logWrite(0, tag, __VA_ARGS__); } while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_D(tag, ...) logWrite(LOG_LEVEL_DEBUG, tag, __VA_ARGS__)
+#else
+#define LOG_D(tag, ...) do { if (0) logWrite(0, tag, __VA_ARGS__); } while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_VERBOSE
+#define LOG_V(tag, ...) logWrite(LOG_LEVEL_VERBOSE, tag, __VA_ARGS__)
+#else
+#define LOG_V(tag, ...) do { if (0) logWrite(0, tag, __VA_ARGS__); } while (0)
+#endif
+
+#endif // LOG_H
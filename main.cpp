@@ -1,105 +1,179 @@
 #include <Arduino.h>
 #include <WiFi.h>
-#include <WebServer.h>  // MUST come BEFORE webserver.h
 #include <PubSubClient.h>
 #include <Adafruit_NeoPixel.h>
 #include <ESPmDNS.h>
 #include "pins.h"
 #include "config.h"
-#include "ledserver.h"   // This comes AFTER WebServer.h
+#include "ledserver.h"
 #include "user_roles.h"
+#include "commandtable.h"
+#include "ledjson.h"
+#include "ledstate.h"
+#include "renderer.h"
+#include "ledstrip.h"
+#include "log.h"
+#include "scheduler.h"
+#include "corkedclient.h"
+#include "outbox.h"
+#include "publishqueue.h"
+#include "mqttlink.h"
+#include "dnscache.h"
+#include "telemetry.h"
+#include "topictrie.h"
+#include "clocksync.h"
+#include "pendingcommands.h"
+#include "metrics.h"
 
 
 // Global objects
 WiFiClient espClient;
-PubSubClient mqttClient(espClient);
-Adafruit_NeoPixel strip(NUM_LEDS, PIN_LED_WS2812_DATA, NEO_GRB + NEO_KHZ800);
+CorkedClient mqttNet(espClient);
+PubSubClient mqttClient(mqttNet);
+PublishQueue publishQueue(mqttClient, mqttNet, outbox);
+LEDStrip strip(NUM_LEDS, PIN_LED_WS2812_DATA, NEO_GRB + NEO_KHZ800);
 
 // Global variables
-unsigned long lastPublish = 0;
-unsigned long lastReconnectAttempt = 0;
 int messageCount = 0;
-int mqttReconnectAttempts = 0;
-
-// LED State structure
-struct LEDState {
-  bool isOn;
-  uint8_t red;
-  uint8_t green;
-  uint8_t blue;
-  uint8_t brightness;
-  bool changed;
-} ledState = {false, 0, 0, 0, LED_BRIGHTNESS, false};
+char ipAddress[16] = "0.0.0.0";  // refreshed on every WiFi connect
+
+// LED state and pixel frame (see ledstate.h)
+LEDState ledState = {false, 0, 0, 0, LED_BRIGHTNESS, false};
+uint8_t frameStorage[NUM_LEDS * 3];
+FrameBuffer frame(frameStorage, NUM_LEDS);
+const Segment ledSegments[] = LED_SEGMENTS;
+
+// Subscribed topic filters and the matcher built from them
+struct TopicFilter {
+  char filter[64];
+  TopicId id;
+};
+const char* const ledGroups[] = LED_GROUPS;
+TopicFilter topicFilters[5 + sizeof(ledGroups) / sizeof(ledGroups[0])];
+uint8_t topicFilterCount = 0;
+TopicTrie topics;
 
 // ========================================
 // Function Declarations
 // ========================================
-void setupWiFi();
+void startWiFi();
+void checkWiFi(void*);
+void onWiFiConnected();
+void scheduleRestart(uint32_t delayMs);
+void buzz(uint32_t durationMs);
 void testNetworkConnectivity();
 void testMQTTBrokerReachability();
 bool reconnectMQTT();
+void onMQTTConnected();
+void onMQTTDisconnected();
+void runNetworkDiagnostics();
 void mqttCallback(char* topic, byte* payload, unsigned int length);
-void handleCommand(String command);
-void handleLEDControl(String command);
+void handleCommand(const char* command, size_t length);
+void handleLEDControl(const char* command, size_t length, int segment = -1);
+void setupTopics();
+void addTopic(TopicId id, const char* format, const char* arg = "");
 void setLED(bool state, uint8_t r, uint8_t g, uint8_t b);
-void publishLEDStatus();
-void publishStatus();
-void publishData();
+void setLEDBrightness(uint8_t brightness);
+void turnLEDOn();
+void clearLEDRange(uint16_t start, uint16_t count);
+void applyLEDCommand(const LEDCommand& cmd);
+bool deferLEDCommand(const char* json, size_t length, int segment, int64_t atMs);
+void applyPendingLEDCommand(const char* json, size_t length, int segment, int32_t lateMs);
+int buildLEDStatus(char* buf, size_t len);
+int buildDeviceStatus(char* buf, size_t len);
+int buildTelemetry(char* buf, size_t len);
 void setupHardware();
 void printMQTTError(int errorCode);
+void loopReportTick(void*);
+void telemetryTick(void*);
+void metricsTick(void*);
+void startReplay();
+void replayTick(void*);
 
 // ========================================
 // WiFi Functions
 // ========================================
-void setupWiFi() {
-  delay(10);
-  Serial.println("\n========================================");
-  Serial.println("WiFi Connection Details:");
-  Serial.println("========================================");
-  Serial.print("SSID: ");
-  Serial.println(WIFI_SSID);
-  Serial.print("Connecting");
+// WiFi comes up in the background: startWiFi() starts associating and a
+// timer polls the status, so loop() keeps running while it connects.
+static TimerHandle wifiTimer = INVALID_TIMER;
+static TimerHandle restartTimer = INVALID_TIMER;
+static uint8_t wifiAttempts = 0;
+static bool networkStarted = false;
 
+void startWiFi() {
+  if (scheduler.pending(wifiTimer) || scheduler.pending(restartTimer)) {
+    return;
+  }
+  LOG_I("WIFI", "Connecting to %s", WIFI_SSID);
   WiFi.mode(WIFI_STA);
   WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+  wifiAttempts = 0;
+  wifiTimer = scheduler.every(500, checkWiFi);
+}
 
-  int attempts = 0;
-  while (WiFi.status() != WL_CONNECTED && attempts < 30) {
-    delay(500);
-    Serial.print(".");
-    attempts++;
+void checkWiFi(void*) {
+  if (WiFi.status() == WL_CONNECTED) {
+    scheduler.cancel(wifiTimer);
+    onWiFiConnected();
+    return;
   }
-  Serial.println();
+  if (++wifiAttempts >= 30) {
+    scheduler.cancel(wifiTimer);
+    LOG_E("WIFI", "✗ WiFi Connection Failed! Status code %d. Rebooting in 10 seconds...", WiFi.status());
+    scheduleRestart(10000);
+  }
+}
 
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.println("✓ WiFi Connected Successfully!");
-    Serial.println("----------------------------------------");
-    Serial.print("IP Address:    ");
-    Serial.println(WiFi.localIP());
-    Serial.print("Subnet Mask:   ");
-    Serial.println(WiFi.subnetMask());
-    Serial.print("Gateway:       ");
-    Serial.println(WiFi.gatewayIP());
-    Serial.print("DNS Server:    ");
-    Serial.println(WiFi.dnsIP());
-    Serial.print("MAC Address:   ");
-    Serial.println(WiFi.macAddress());
-    Serial.print("RSSI:          ");
-    Serial.print(WiFi.RSSI());
-    Serial.println(" dBm");
-    Serial.print("Channel:       ");
-    Serial.println(WiFi.channel());
-    Serial.println("========================================");
+void onWiFiConnected() {
+  snprintf(ipAddress, sizeof(ipAddress), "%s", WiFi.localIP().toString().c_str());
+  dnsCache.refreshAll();
+  startClockSync();
+  LOG_I("WIFI", "✓ WiFi Connected: IP %s, gateway %s, DNS %s, RSSI %d dBm, channel %d",
+        ipAddress, WiFi.gatewayIP().toString().c_str(),
+        WiFi.dnsIP().toString().c_str(), WiFi.RSSI(), WiFi.channel());
+
+  if (networkStarted) {
+    return;
+  }
+  networkStarted = true;
+
+  // First connection after boot: mDNS and the web server. Network
+  // diagnostics run on the MQTT connect task before its first attempt.
+  if (!MDNS.begin("tomfcb")) {
+    Serial.println("❌ Error setting up MDNS");
   } else {
-    Serial.println("✗ WiFi Connection Failed!");
-    Serial.print("WiFi Status Code: ");
-    Serial.println(WiFi.status());
-    Serial.println("Rebooting in 10 seconds...");
-    delay(10000);
-    ESP.restart();
+    Serial.println("✅ MDNS responder started");
+    Serial.println("========================================");
+    Serial.println("🌐 Access your ESP32 at: http://tomfcb.local");
+    Serial.println("========================================");
+    setupWebServer();
   }
 }
 
+static void restartNow(void*) {
+  ESP.restart();
+}
+
+// Gives the log task and open connections a moment before rebooting
+void scheduleRestart(uint32_t delayMs) {
+  if (!scheduler.pending(restartTimer)) {
+    restartTimer = scheduler.schedule(delayMs, restartNow);
+  }
+}
+
+static TimerHandle buzzerTimer = INVALID_TIMER;
+
+static void buzzerOff(void*) {
+  digitalWrite(PIN_BUZZER, LOW);
+}
+
+// Sounds the buzzer for durationMs without blocking; a new call restarts it
+void buzz(uint32_t durationMs) {
+  scheduler.cancel(buzzerTimer);
+  digitalWrite(PIN_BUZZER, HIGH);
+  buzzerTimer = scheduler.schedule(durationMs, buzzerOff);
+}
+
 // ========================================
 // Network Diagnostics
 // ========================================
@@ -112,19 +186,21 @@ void testNetworkConnectivity() {
   Serial.print("Gateway IP: ");
   Serial.println(WiFi.gatewayIP());
   
-  // Test 2: DNS Resolution
-  IPAddress testIP;
-  Serial.print("Testing DNS resolution... ");
-  if (WiFi.hostByName("google.com", testIP)) {
-    Serial.print("✓ SUCCESS - google.com resolves to ");
-    Serial.println(testIP);
+  // Test 2: DNS Resolution (as seen by the cache, never waits on DNS)
+  IPAddress brokerIP;
+  DnsEntry dns;
+  bool resolved = dnsCache.lookup(MQTT_BROKER, brokerIP);
+  Serial.print("DNS: ");
+  if (dnsCache.entry(MQTT_BROKER, dns)) {
+    Serial.printf("%s, last lookup %lu ms, %u failures in a row%s\n", dns.valid ? "resolved" : "unresolved",
+                  (unsigned long)dns.lookupMs, dns.failures,
+                  dns.valid && dns.failures > 0 ? " - using last good address" : "");
   } else {
-    Serial.println("✗ FAILED - DNS not working");
+    Serial.println(resolved ? "broker is an IP address" : "✗ broker not in cache");
   }
   
   // Test 3: Check if on same subnet as broker
-  IPAddress brokerIP;
-  if (WiFi.hostByName(MQTT_BROKER, brokerIP)) {
+  if (resolved) {
     Serial.print("MQTT Broker IP: ");
     Serial.println(brokerIP);
     
@@ -162,10 +238,18 @@ void testMQTTBrokerReachability() {
   WiFiClient testClient;
   testClient.setTimeout(5000); // 5 second timeout
   
-  Serial.print("Attempting TCP connection... ");
+  IPAddress brokerIP;
+  if (!dnsCache.lookup(MQTT_BROKER, brokerIP)) {
+    Serial.println("✗ Broker address not resolved yet, skipping TCP test");
+    Serial.println("========================================\n");
+    return;
+  }
+  Serial.print("Attempting TCP connection to ");
+  Serial.print(brokerIP);
+  Serial.print("... ");
   
   unsigned long startTime = millis();
-  bool connected = testClient.connect(MQTT_BROKER, MQTT_PORT);
+  bool connected = testClient.connect(brokerIP, MQTT_PORT);
   unsigned long duration = millis() - startTime;
   
   if (connected) {
@@ -200,74 +284,94 @@ void testMQTTBrokerReachability() {
 // MQTT Error Code Decoder
 // ========================================
 void printMQTTError(int errorCode) {
-  Serial.print("MQTT Error Code: ");
-  Serial.print(errorCode);
-  Serial.print(" - ");
-  
+  const char* text;
   switch(errorCode) {
-    case -4:
-      Serial.println("MQTT_CONNECTION_TIMEOUT - Server didn't respond within keepalive time");
-      break;
-    case -3:
-      Serial.println("MQTT_CONNECTION_LOST - Network cable unplugged");
-      break;
-    case -2:
-      Serial.println("MQTT_CONNECT_FAILED - Network connection failed");
-      Serial.println("  → Cannot reach broker (check IP, port, firewall)");
-      break;
-    case -1:
-      Serial.println("MQTT_DISCONNECTED - Cleanly disconnected");
-      break;
-    case 0:
-      Serial.println("MQTT_CONNECTED - Connection successful");
-      break;
-    case 1:
-      Serial.println("MQTT_CONNECT_BAD_PROTOCOL - Protocol version not supported");
-      break;
-    case 2:
-      Serial.println("MQTT_CONNECT_BAD_CLIENT_ID - Client ID rejected");
-      break;
-    case 3:
-      Serial.println("MQTT_CONNECT_UNAVAILABLE - Server unavailable");
+    case -4: text = "MQTT_CONNECTION_TIMEOUT - Server didn't respond within keepalive time"; break;
+    case -3: text = "MQTT_CONNECTION_LOST - Network cable unplugged"; break;
+    case -2: text = "MQTT_CONNECT_FAILED - Cannot reach broker (check IP, port, firewall)"; break;
+    case -1: text = "MQTT_DISCONNECTED - Cleanly disconnected"; break;
+    case 0:  text = "MQTT_CONNECTED - Connection successful"; break;
+    case 1:  text = "MQTT_CONNECT_BAD_PROTOCOL - Protocol version not supported"; break;
+    case 2:  text = "MQTT_CONNECT_BAD_CLIENT_ID - Client ID rejected"; break;
+    case 3:  text = "MQTT_CONNECT_UNAVAILABLE - Server unavailable"; break;
+    case 4:  text = "MQTT_CONNECT_BAD_CREDENTIALS - Bad username/password"; break;
+    case 5:  text = "MQTT_CONNECT_UNAUTHORIZED - Not authorized to connect"; break;
+    default: text = "UNKNOWN ERROR CODE"; break;
+  }
+  LOG_W("MQTT", "Error code %d - %s", errorCode, text);
+}
+
+// ========================================
+// MQTT Callback
+// ========================================
+void mqttCallback(char* topic, byte* payload, unsigned int length) {
+  LOG_D("MQTT", "Message arrived [%s]: %.*s", topic, (int)length, (const char*)payload);
+
+  // Dispatch straight from PubSubClient's buffer - no String copies
+  TopicMatch match;
+  switch (topics.match(topic, strlen(topic), match)) {
+    case TOPIC_COMMAND:
+      handleCommand((const char*)payload, length);
       break;
-    case 4:
-      Serial.println("MQTT_CONNECT_BAD_CREDENTIALS - Bad username/password");
+    case TOPIC_LED_CONTROL:
+    case TOPIC_DEVICE_SET:
+    case TOPIC_GROUP_SET:
+      handleLEDControl((const char*)payload, length);
       break;
-    case 5:
-      Serial.println("MQTT_CONNECT_UNAUTHORIZED - Not authorized to connect");
+    case TOPIC_SEGMENT_SET: {
+      // <prefix>/<device>/<segment>/set, the segment is the only "+"
+      int segment = 0;
+      for (uint8_t i = 0; i < match.wildcardLength[0]; i++) {
+        char c = match.wildcard[0][i];
+        if (c < '0' || c > '9' || segment > 255) {
+          segment = -1;
+          break;
+        }
+        segment = segment * 10 + (c - '0');
+      }
+      if (segment < 0 || segment > 255 || match.wildcardLength[0] == 0) {
+        LOG_W("MQTT", "✗ Bad segment in %s", topic);
+        break;
+      }
+      handleLEDControl((const char*)payload, length, segment);
       break;
+    }
     default:
-      Serial.println("UNKNOWN ERROR CODE");
       break;
   }
 }
 
-// ========================================
-// MQTT Callback
-// ========================================
-void mqttCallback(char* topic, byte* payload, unsigned int length) {
-  Serial.print("Message arrived [");
-  Serial.print(topic);
-  Serial.print("]: ");
-  
-  String message = "";
-  for (unsigned int i = 0; i < length; i++) {
-    message += (char)payload[i];
+// Topic filters are built once from config.h; onMQTTConnected() subscribes
+// to the same list
+void setupTopics() {
+  addTopic(TOPIC_COMMAND, MQTT_TOPIC_COMMAND);
+  addTopic(TOPIC_LED_CONTROL, MQTT_TOPIC_LED_CONTROL);
+  addTopic(TOPIC_DEVICE_SET, MQTT_TOPIC_DEVICE_PREFIX "/%s/set", DEVICE_NAME);
+  addTopic(TOPIC_SEGMENT_SET, MQTT_TOPIC_DEVICE_PREFIX "/%s/+/set", DEVICE_NAME);
+  for (const char* group : ledGroups) {
+    addTopic(TOPIC_GROUP_SET, MQTT_TOPIC_DEVICE_PREFIX "/group/%s/set", group);
   }
-  Serial.println(message);
+}
 
-  if (String(topic) == MQTT_TOPIC_COMMAND) {
-    handleCommand(message);
+void addTopic(TopicId id, const char* format, const char* arg) {
+  if (topicFilterCount >= sizeof(topicFilters) / sizeof(topicFilters[0])) {
+    LOG_E("MQTT", "✗ Topic list full");
+    return;
   }
-  else if (String(topic) == MQTT_TOPIC_LED_CONTROL) {
-    handleLEDControl(message);
+  TopicFilter& t = topicFilters[topicFilterCount];
+  snprintf(t.filter, sizeof(t.filter), format, arg);
+  t.id = id;
+  if (!topics.add(t.filter, id)) {
+    LOG_E("MQTT", "✗ Cannot match topic %s", t.filter);
+    return;
   }
+  topicFilterCount++;
 }
 
 // ========================================
 // Command Handlers
 // ========================================
-void handleCommand(String command) {
+void handleCommand(const char* command, size_t length) {
   time_t now;
   struct tm timeinfo;
   time(&now);
@@ -276,131 +380,344 @@ void handleCommand(String command) {
   char timestamp[30];
   strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", &timeinfo);
 
-  Serial.printf("📥 Command received at %s: %s\n", timestamp, command.c_str());
-  Serial.print("Processing command: ");
-  Serial.println(command);
+  LOG_I("MQTT", "📥 Command received at %s: %.*s", timestamp, (int)length, command);
   
-  if (command == "buzzer_on" && ENABLE_BUZZER) {
-    digitalWrite(PIN_BUZZER, HIGH);
-    Serial.println("✓ Buzzer ON");
-  } 
-  else if (command == "buzzer_off" && ENABLE_BUZZER) {
-    digitalWrite(PIN_BUZZER, LOW);
-    Serial.println("✓ Buzzer OFF");
-  }
-  else if (command == "status") {
-    publishStatus();
-  }
-  else if (command == "led_status") {
-    publishLEDStatus();
-  }
-  else if (command == "restart") {
-    Serial.println("⚠ Restart command received. Rebooting...");
-    delay(1000);
-    ESP.restart();
-  }
-  else if (command == "test_network") {
-    testNetworkConnectivity();
-    testMQTTBrokerReachability();
+  switch (lookupCommand(command, length)) {
+    case CMD_BUZZER_ON:
+      if (ENABLE_BUZZER) {
+        digitalWrite(PIN_BUZZER, HIGH);
+        LOG_I("BUZZER", "✓ Buzzer ON");
+      }
+      break;
+    case CMD_BUZZER_OFF:
+      if (ENABLE_BUZZER) {
+        digitalWrite(PIN_BUZZER, LOW);
+        LOG_I("BUZZER", "✓ Buzzer OFF");
+      }
+      break;
+    case CMD_STATUS:
+      publishQueue.request(PUB_DEVICE_STATUS, millis());
+      break;
+    case CMD_LED_STATUS:
+      publishQueue.request(PUB_LED_STATUS, millis());
+      break;
+    case CMD_RESTART:
+      LOG_W("MQTT", "⚠ Restart command received. Rebooting...");
+      scheduleRestart(1000);
+      break;
+    case CMD_TEST_NETWORK:
+      mqttLink.requestDiagnostics();
+      break;
+    default:
+      break;
   }
 }
-  
-void handleLEDControl(String command) {
-  Serial.print("LED Command: ");
-  Serial.println(command);
+
+// segment >= 0 scopes the command to one segment (from the topic)
+void handleLEDControl(const char* command, size_t length, int segment) {
+  LOG_D("LED", "Command: %.*s", (int)length, command);
   
   if (!ENABLE_WS2812B) {
-    Serial.println("✗ WS2812B not enabled");
+    LOG_W("LED", "✗ WS2812B not enabled");
     return;
   }
   
-  if (command == "on") {
-    if (ledState.red == 0 && ledState.green == 0 && ledState.blue == 0) {
-      setLED(true, 255, 255, 255);
+  const TableEntry* led = lookupLEDCommand(command, length);
+  if (led != nullptr && segment >= 0) {
+    // Keywords on a segment stay within it: "off" blanks just that segment
+    LEDCommand cmd = {};
+    cmd.hasSegment = true;
+    cmd.segment = segment;
+    if (led->id == LED_CMD_ON || led->id == LED_CMD_OFF) {
+      cmd.hasState = true;
+      cmd.state = led->id == LED_CMD_ON;
     } else {
-      setLED(true, ledState.red, ledState.green, ledState.blue);
+      cmd.hasRed = cmd.hasGreen = cmd.hasBlue = true;
+      cmd.red = led->r;
+      cmd.green = led->g;
+      cmd.blue = led->b;
+    }
+    applyLEDCommand(cmd);
+  }
+  else if (led != nullptr) {
+    switch (led->id) {
+      case LED_CMD_ON:
+        turnLEDOn();
+        break;
+      case LED_CMD_OFF:
+        setLED(false, 0, 0, 0);
+        break;
+      case LED_CMD_COLOR:
+        setLED(true, led->r, led->g, led->b);
+        break;
+    }
+  }
+  else if (length > 0 && command[0] == '{') {
+    LEDCommand cmd;
+    if (!parseLEDCommand(command, length, cmd)) {
+      LOG_W("LED", "✗ Malformed LED JSON");
+      return;
+    }
+    if (cmd.hasAt && deferLEDCommand(command, length, segment, cmd.at)) {
+      return;
     }
+    if (segment >= 0) {
+      cmd.hasSegment = true;
+      cmd.segment = segment;
+    }
+    applyLEDCommand(cmd);
+  }
+}
+
+// Holds a command with an "at" time until then. False means apply it now:
+// the clock is not synced yet or the queue cannot take it.
+bool deferLEDCommand(const char* json, size_t length, int segment, int64_t atMs) {
+  if (!clockSynced()) {
+    LOG_W("LED", "⚠ Clock not synced, applying timed command now");
+    return false;
+  }
+  int64_t ahead = atMs - epochMs();
+  if (ahead > PENDING_MAX_AHEAD_MS) {
+    LOG_W("LED", "✗ Command target %ld s ahead, dropped", (long)(ahead / 1000));
+    return true;
   }
-  else if (command == "off") {
-    setLED(false, 0, 0, 0);
+  if (!pendingCommands.add(json, length, segment, atMs)) {
+    LOG_W("LED", "⚠ Cannot hold timed command, applying now");
+    return false;
   }
-  else if (command == "red") {
-    setLED(true, 255, 0, 0);
+  LOG_D("LED", "Command held for %ld ms", (long)ahead);
+  return true;
+}
+
+// Called from loop() when a held command comes due
+void applyPendingLEDCommand(const char* json, size_t length, int segment, int32_t lateMs) {
+  LEDCommand cmd;
+  if (!parseLEDCommand(json, length, cmd)) {
+    return;
   }
-  else if (command == "green") {
-    setLED(true, 0, 255, 0);
+  if (segment >= 0) {
+    cmd.hasSegment = true;
+    cmd.segment = segment;
   }
-  else if (command == "blue") {
-    setLED(true, 0, 0, 255);
+  applyLEDCommand(cmd);
+  LOG_D("LED", "✓ Timed command applied, %ld ms late", (long)lateMs);
+}
+
+void applyLEDCommand(const LEDCommand& cmd) {
+  if (cmd.hasBrightness) {
+    setLEDBrightness(cmd.brightness);
   }
-  else if (command == "white") {
-    setLED(true, 255, 255, 255);
+
+  // A segment or range keeps state changes to itself
+  bool ranged = cmd.hasSegment || cmd.hasCount;
+  if (cmd.hasState && !cmd.state && !ranged) {
+    setLEDPower(false);
+    return;
   }
-  else if (command == "yellow") {
-    setLED(true, 255, 255, 0);
+
+  uint16_t start = 0;
+  uint16_t count = NUM_LEDS;
+  if (cmd.hasSegment) {
+    const Segment* seg = frame.segment(cmd.segment);
+    if (seg == nullptr) {
+      LOG_W("LED", "✗ Unknown LED segment %d", cmd.segment);
+      return;
+    }
+    start = seg->start;
+    count = seg->count;
+  } else if (cmd.hasCount) {
+    start = cmd.start;
+    count = cmd.count;
   }
-  else if (command == "cyan") {
-    setLED(true, 0, 255, 255);
+
+  if (cmd.hasState && !cmd.state) {
+    clearLEDRange(start, count);
+    return;
   }
-  else if (command == "magenta") {
-    setLED(true, 255, 0, 255);
+
+  // Channels that are left out keep their current value
+  bool hasColor = cmd.hasRed || cmd.hasGreen || cmd.hasBlue;
+  uint8_t r = cmd.hasRed ? cmd.red : ledState.red;
+  uint8_t g = cmd.hasGreen ? cmd.green : ledState.green;
+  uint8_t b = cmd.hasBlue ? cmd.blue : ledState.blue;
+
+  if (cmd.effect != nullptr) {
+    uint8_t type = lookupEffect(cmd.effect, cmd.effectLength);
+    if (type == EFFECT_NONE) {
+      FrameLock lock;
+      cancelEffect();
+    } else {
+      startLEDEffect(type, start, count, r, g, b, cmd.hasTransition ? cmd.transitionMs : 0);
+    }
+  } else if (hasColor && cmd.hasTransition && cmd.transitionMs > 0) {
+    startLEDEffect(EFFECT_FADE, start, count, r, g, b, cmd.transitionMs);
+  } else if (hasColor) {
+    setLEDRange(start, count, r, g, b);
+  } else if (cmd.hasState && ranged) {
+    // Like turnLEDOn(): the current color, or white if there is none
+    if (r == 0 && g == 0 && b == 0) {
+      r = g = b = 255;
+    }
+    setLEDRange(start, count, r, g, b);
+  } else if (cmd.hasState) {
+    turnLEDOn();
   }
-  else if (command.startsWith("{")) {
-    int rPos = command.indexOf("\"r\":");
-    int gPos = command.indexOf("\"g\":");
-    int bPos = command.indexOf("\"b\":");
-    
-    if (rPos > 0 && gPos > 0 && bPos > 0) {
-      int r = command.substring(rPos + 4).toInt();
-      int g = command.substring(gPos + 4).toInt();
-      int b = command.substring(bPos + 4).toInt();
-      setLED(true, r, g, b);
+
+  if (cmd.pixels != nullptr) {
+    uint16_t changed = 0;
+    size_t written;
+    {
+      FrameLock lock;
+      cancelEffect();
+      written = forEachPixel(cmd, [&changed](size_t i, uint8_t r, uint8_t g, uint8_t b) {
+        if (i < NUM_LEDS && frame.setPixel(i, r, g, b)) {
+          changed++;
+        }
+      });
+      if (changed > 0) {
+        ledState.isOn = true;
+        ledState.changed = true;
+      }
     }
+    if (changed > 0) {
+      requestRender();
+      notifyLEDStateChanged();
+    }
+    LOG_D("LED", "✓ %u pixels written from %u (%u changed)", (unsigned)written, cmd.start, changed);
   }
 }
 
 // ========================================
 // LED Control Functions
 // ========================================
+// Whole strip to one color, or off
 void setLED(bool state, uint8_t r, uint8_t g, uint8_t b) {
-  bool hasChanged = (ledState.isOn != state) || 
-                    (ledState.red != r) || 
-                    (ledState.green != g) || 
-                    (ledState.blue != b);
-  
-  if (!hasChanged) {
-    Serial.println("ℹ No LED change detected");
+  if (!state) {
+    setLEDPower(false);
     return;
   }
-  
-  ledState.isOn = state;
-  ledState.changed = true;
-  
-  if (state) {
+  setLEDRange(0, NUM_LEDS, r, g, b);
+}
+
+// Static writes stop any running effect and wake the render task, which
+// pushes the changed pixels out; the caller never waits for the strip.
+bool setLEDRange(uint16_t start, uint16_t count, uint8_t r, uint8_t g, uint8_t b) {
+  {
+    FrameLock lock;
+    cancelEffect();
+    uint16_t changedPixels = frame.fill(start, count, r, g, b);
+    bool colorChanged = (ledState.red != r) || (ledState.green != g) || (ledState.blue != b);
+    
+    if (changedPixels == 0 && !colorChanged && ledState.isOn) {
+      LOG_V("LED", "ℹ No LED change detected");
+      return false;
+    }
+    
     ledState.red = r;
     ledState.green = g;
     ledState.blue = b;
-    
-    strip.setBrightness(ledState.brightness);
-    strip.setPixelColor(0, strip.Color(r, g, b));
-    strip.show();
-    
-    Serial.printf("✓ LED ON - RGB(%d, %d, %d) - #%02X%02X%02X\n", r, g, b, r, g, b);
+    ledState.isOn = true;
+    ledState.changed = true;
+  }
+  requestRender();
+  notifyLEDStateChanged();
+  
+  LOG_D("LED", "✓ LED ON - pixels %u+%u RGB(%d, %d, %d) - #%02X%02X%02X", start, count, r, g, b, r, g, b);
+  return true;
+}
+
+// Blanks part of the strip. The solid color and power state are left
+// alone: they still describe the rest of the strip, and a later "on" for
+// the range brings the color back.
+void clearLEDRange(uint16_t start, uint16_t count) {
+  uint16_t changedPixels;
+  {
+    FrameLock lock;
+    cancelEffect();
+    changedPixels = frame.fill(start, count, 0, 0, 0);
+  }
+  if (changedPixels > 0) {
+    requestRender();
+  }
+  LOG_D("LED", "✓ LED OFF - pixels %u+%u", start, count);
+}
+
+bool setLEDSegment(uint8_t id, uint8_t r, uint8_t g, uint8_t b) {
+  const Segment* seg = frame.segment(id);
+  if (seg == nullptr) {
+    LOG_W("LED", "✗ Unknown LED segment %d", id);
+    return false;
+  }
+  return setLEDRange(seg->start, seg->count, r, g, b);
+}
+
+// Blanks or restores the output without touching the frame contents
+void setLEDPower(bool on) {
+  {
+    FrameLock lock;
+    if (ledState.isOn == on) {
+      return;
+    }
+    ledState.isOn = on;
+    ledState.changed = true;
+  }
+  requestRender();
+  notifyLEDStateChanged();
+  LOG_D("LED", "%s", on ? "✓ LED ON" : "✓ LED OFF");
+}
+
+// Restores the last frame, or white if there is nothing to show
+void turnLEDOn() {
+  bool black;
+  {
+    FrameLock lock;
+    black = frame.isBlack();
+  }
+  if (black) {
+    setLED(true, 255, 255, 255);
   } else {
-    strip.clear();
-    strip.show();
-    Serial.println("✓ LED OFF");
+    setLEDPower(true);
   }
 }
 
-void publishLEDStatus() {
-  if (!mqttClient.connected()) {
-    Serial.println("✗ Cannot publish LED status - MQTT not connected");
-    return;
+void setLEDBrightness(uint8_t brightness) {
+  {
+    FrameLock lock;
+    if (ledState.brightness == brightness) {
+      return;
+    }
+    ledState.brightness = brightness;
+    ledState.changed = true;
   }
-  
-  char msg[200];
-  
+  requestRender();
+  notifyLEDStateChanged();
+  LOG_D("LED", "✓ LED brightness %d", brightness);
+}
+
+// Runs an effect over a range on the render task; handlers return at once
+bool startLEDEffect(uint8_t type, uint16_t start, uint16_t count, uint8_t r, uint8_t g, uint8_t b, uint32_t durationMs) {
+  EffectParams params = {type, start, count, r, g, b, durationMs};
+  {
+    FrameLock lock;
+    ledState.red = r;
+    ledState.green = g;
+    ledState.blue = b;
+    ledState.isOn = true;
+    ledState.changed = true;
+  }
+  if (!postEffect(params)) {
+    LOG_W("LED", "✗ Unknown effect %d", type);
+    return false;
+  }
+  notifyLEDStateChanged();
+  LOG_D("LED", "✓ Effect %s on pixels %u+%u for %lu ms", getEffect(type)->name, start, count, (unsigned long)durationMs);
+  return true;
+}
+
+// ========================================
+// Publish payloads (built by publishQueue when it flushes)
+// ========================================
+int buildLEDStatus(char* buf, size_t len) {
   const char* colorName = "custom";
 
   if (ledState.red == 255 && ledState.green == 0 && ledState.blue == 0) {
@@ -427,145 +744,107 @@ void publishLEDStatus() {
   char timestamp[30];
   strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", &timeinfo);
 
-  snprintf(msg, sizeof(msg),
-    "{\"state\":\"%s\",\"color\":\"%s\",\"timestamp\":\"%s\"}",
-    ledState.isOn ? "on" : "off",
-    colorName,
-    timestamp
-  );
-  
-  if (mqttClient.publish(MQTT_TOPIC_LED_STATUS, msg, true)) {
-    Serial.print("✓ LED Status Published: ");
-    Serial.println(msg);
-    ledState.changed = false;
-  } else {
-    Serial.println("✗ Failed to publish LED status");
-  }
+  LEDStatusMsg msg;
+  msg.state = ledState.isOn ? "on" : "off";
+  msg.color = colorName;
+  msg.timestamp = timestamp;
+  msg.device = DEVICE_NAME;
+  msg.lateMs = pendingCommands.stats().lastLateMs;
+  return encodeTelemetry(msg, buf, len);
 }
 
 // ========================================
 // MQTT Functions with Better Error Handling
 // ========================================
+// Runs on the mqttLink connect task and may block; mqttLink.poll() in
+// loop() picks up the result and handles backoff
 bool reconnectMQTT() {
-  if (WiFi.status() != WL_CONNECTED) {
-    Serial.println("⚠ WiFi not connected. Cannot connect to MQTT.");
+  // The address comes from the DNS cache, so a slow or dead resolver
+  // never holds up the connect
+  IPAddress brokerIP;
+  if (!dnsCache.lookup(MQTT_BROKER, brokerIP)) {
+    LOG_W("MQTT", "✗ No address for %s yet", MQTT_BROKER);
     return false;
   }
-  
-  // Limit reconnection attempts
-  if (mqttReconnectAttempts > 0 && mqttReconnectAttempts % 10 == 0) {
-    Serial.println("\n⚠ Multiple MQTT connection failures detected.");
-    Serial.println("Running network diagnostics...");
-    testNetworkConnectivity();
-    testMQTTBrokerReachability();
-  }
-  
-  Serial.println("\n----------------------------------------");
-  Serial.print("MQTT Connection Attempt #");
-  Serial.println(mqttReconnectAttempts + 1);
-  Serial.print("Broker: ");
-  Serial.print(MQTT_BROKER);
-  Serial.print(":");
-  Serial.println(MQTT_PORT);
-  
+  mqttClient.setServer(brokerIP, MQTT_PORT);
+
   String clientId = MQTT_CLIENT_ID;
   clientId += String(random(0xffff), HEX);
-  Serial.print("Client ID: ");
-  Serial.println(clientId);
+  LOG_I("MQTT", "Connection attempt #%lu to %s:%d as %s (%s)", (unsigned long)mqttLink.stats().attempts, MQTT_BROKER,
+        MQTT_PORT, clientId.c_str(), strlen(MQTT_USERNAME) > 0 ? "with authentication" : "no authentication");
   
   bool connected = false;
   
-  Serial.print("Connecting... ");
   if (strlen(MQTT_USERNAME) > 0) {
-    Serial.println("(with authentication)");
     connected = mqttClient.connect(clientId.c_str(), MQTT_USERNAME, MQTT_PASSWORD);
   } else {
-    Serial.println("(no authentication)");
     connected = mqttClient.connect(clientId.c_str());
   }
   
-  if (connected) {
-    Serial.println("✓✓✓ MQTT CONNECTED SUCCESSFULLY! ✓✓✓");
-    mqttReconnectAttempts = 0;
-    
-    // Subscribe to topics
-    Serial.println("Subscribing to topics...");
-    if (mqttClient.subscribe(MQTT_TOPIC_COMMAND)) {
-      Serial.print("  ✓ ");
-      Serial.println(MQTT_TOPIC_COMMAND);
-    }
-    
-    if (mqttClient.subscribe(MQTT_TOPIC_LED_CONTROL)) {
-      Serial.print("  ✓ ");
-      Serial.println(MQTT_TOPIC_LED_CONTROL);
-    }
-    
-    // Publish initial status
-    publishStatus();
-    publishLEDStatus();
-    
-    Serial.println("----------------------------------------\n");
-    return true;
-    
-  } else {
-    mqttReconnectAttempts++;
-    Serial.println("✗ MQTT CONNECTION FAILED!");
+  if (!connected) {
+    LOG_W("MQTT", "✗ Connection failed");
     printMQTTError(mqttClient.state());
-    Serial.println("----------------------------------------\n");
-    return false;
   }
+  return connected;
 }
 
-void publishStatus() {
-  if (!mqttClient.connected()) {
-    return;
+// loop() side of a successful connect
+void onMQTTConnected() {
+  // Subscribe to topics
+  for (uint8_t i = 0; i < topicFilterCount; i++) {
+    if (mqttClient.subscribe(topicFilters[i].filter)) {
+      LOG_I("MQTT", "  ✓ %s", topicFilters[i].filter);
+    }
   }
   
-  char msg[250];
-  snprintf(msg, 250, 
-    "{\"device\":\"%s\",\"ip\":\"%s\",\"rssi\":%d,\"uptime\":%lu,\"free_heap\":%lu,\"reconnects\":%d}",
-    DEVICE_NAME,
-    WiFi.localIP().toString().c_str(),
-    WiFi.RSSI(),
-    millis() / 1000,
-    ESP.getFreeHeap(),
-    mqttReconnectAttempts
-  );
-  
-  mqttClient.publish(MQTT_TOPIC_LED_STATUS, msg);
-  Serial.print("✓ Status published: ");
-  Serial.println(msg);  
+  // Publish initial status
+  publishQueue.setOnline(true);
+  publishQueue.request(PUB_DEVICE_STATUS, millis());
+  publishQueue.request(PUB_LED_STATUS, millis());
+  startReplay();
 }
 
-void publishData() {
-  if (!mqttClient.connected()) {
-    return;
-  }
-  
+void onMQTTDisconnected() {
+  publishQueue.setOnline(false);
+}
+
+// Connect task, before the first attempt and after repeated failures
+void runNetworkDiagnostics() {
+  testNetworkConnectivity();
+  testMQTTBrokerReachability();
+}
+
+int buildDeviceStatus(char* buf, size_t len) {
+  DeviceStatusMsg msg;
+  msg.device = DEVICE_NAME;
+  msg.ip = ipAddress;
+  msg.rssi = WiFi.RSSI();
+  msg.uptime = millis() / 1000;
+  msg.freeHeap = ESP.getFreeHeap();
+  msg.reconnects = mqttLink.stats().consecutiveFailures;
+  msg.loopMaxUs = loopStats.lastMaxUs;
+  const MqttLinkStats& link = mqttLink.stats();
+  msg.mqttConnects = link.connects;
+  msg.mqttFailures = link.failures;
+  msg.connectMs = link.lastConnectMs;
+  msg.maxConnectMs = link.maxConnectMs;
+  msg.outageMs = link.lastOutageMs;
+  return encodeTelemetry(msg, buf, len);
+}
+
+int buildTelemetry(char* buf, size_t len) {
   messageCount++;
-  
-  char msg[350];
-  
-  snprintf(msg, 350,
-    "{\"device\":\"%s\",\"count\":%d,\"uptime\":%lu,\"rssi\":%d,\"button\":%d,\"led\":{\"state\":\"%s\",\"r\":%d,\"g\":%d,\"b\":%d}}",
-    DEVICE_NAME,
-    messageCount,
-    millis() / 1000,
-    WiFi.RSSI(),
-    digitalRead(PIN_BUTTON_ON_BOARD),
-    ledState.isOn ? "on" : "off",
-    ledState.red,
-    ledState.green,
-    ledState.blue
-  );
-  
-  if (mqttClient.publish(MQTT_TOPIC_LED_STATUS, msg)) {
-    Serial.print("✓ Data published (#");
-    Serial.print(messageCount);
-    Serial.println(")");
-  } else {
-    Serial.println("✗ Failed to publish data");
-  }
+  TelemetryDataMsg msg;
+  msg.device = DEVICE_NAME;
+  msg.count = messageCount;
+  msg.uptime = millis() / 1000;
+  msg.rssi = WiFi.RSSI();
+  msg.button = digitalRead(PIN_BUTTON_ON_BOARD);
+  msg.led = ledState.isOn ? "on" : "off";
+  msg.r = ledState.red;
+  msg.g = ledState.green;
+  msg.b = ledState.blue;
+  return encodeTelemetry(msg, buf, len);
 }
 
 // ========================================
@@ -588,8 +867,11 @@ void setupHardware() {
   if (ENABLE_WS2812B) {
     strip.begin();
     strip.show();
-    strip.setBrightness(LED_BRIGHTNESS);
-    Serial.println("✓ WS2812B LED (GPIO 38)");
+    for (size_t i = 0; i < sizeof(ledSegments) / sizeof(ledSegments[0]); i++) {
+      frame.defineSegment(i, ledSegments[i].start, ledSegments[i].count);
+    }
+    startRenderTask();
+    Serial.printf("✓ WS2812B LED strip (GPIO 38, %d pixels, render task on core %d)\n", NUM_LEDS, RENDER_TASK_CORE);
     
     // Default LED ON (white)
     setLED(true, 255, 255, 255);
@@ -605,6 +887,7 @@ void setupHardware() {
 // ========================================
 void setup() {
   Serial.begin(SERIAL_BAUD_RATE);
+  logStart();
   delay(2000);
   
   Serial.println("\n\n\n");
@@ -627,14 +910,28 @@ void setup() {
   Serial.println();
   
   setupHardware();
-  setupWiFi();
-  testNetworkConnectivity();
-  testMQTTBrokerReachability();
   
-  mqttClient.setServer(MQTT_BROKER, MQTT_PORT);
+  // setServer() is called per attempt with the cached broker address
+  setupTopics();
   mqttClient.setCallback(mqttCallback);
-  mqttClient.setBufferSize(512);
+  // Room for the MQTT header and topic on top of the largest payload
+  mqttClient.setBufferSize(MQTT_PUBLISH_BUFFER + 128);
   mqttClient.setKeepAlive(15);
+
+  // All three share the status topic; only the LED state is retained
+  publishQueue.define(PUB_LED_STATUS, MQTT_TOPIC_LED_STATUS, true, buildLEDStatus);
+  publishQueue.define(PUB_DEVICE_STATUS, MQTT_TOPIC_LED_STATUS, false, buildDeviceStatus);
+  publishQueue.define(PUB_TELEMETRY, MQTT_TOPIC_LED_STATUS, false, buildTelemetry, true);
+  publishQueue.define(PUB_METRICS, MQTT_TOPIC_METRICS, false, buildMetrics);
+  outbox.begin();
+  dnsCache.begin();
+  mqttLink.begin(mqttClient, reconnectMQTT, onMQTTConnected, onMQTTDisconnected, runNetworkDiagnostics);
+
+  // Everything timed from here on runs off the scheduler in loop()
+  startWiFi();
+  scheduler.every(LOOP_REPORT_INTERVAL, loopReportTick);
+  scheduler.every(PUBLISH_INTERVAL, telemetryTick);
+  scheduler.every(METRICS_PUBLISH_INTERVAL_MS, metricsTick);
   
   Serial.println("✓ Setup complete! Starting main loop...\n");
 
@@ -643,61 +940,104 @@ void setup() {
   Serial.println("mosquitto_pub -h broker.hivemq.com -t homeled/control -m \"red\" -- Will turn LED red");
   Serial.println("========================================");
 
-  if (!MDNS.begin("tomfcb")) {
-    Serial.println("❌ Error setting up MDNS");
-  } else {
-    Serial.println("✅ MDNS responder started");
-    Serial.println("========================================");
-    Serial.println("🌐 Access your ESP32 at: http://tomfcb.local");
-    Serial.println("========================================");
-    setupWebServer();
-    pinMode(LED_PIN, OUTPUT);
-    Serial.begin(115200);
+  pinMode(LED_PIN, OUTPUT);
 
-    
+  if (PIN_BUTTON_ON_BOARD) {
+    buzz(500);
   }
-  if(PIN_BUTTON_ON_BOARD)
-{
-  
-  digitalWrite(PIN_BUZZER, HIGH); 
-  delay(500);
-  digitalWrite(PIN_BUZZER, LOW);
 }
+
+void loopReportTick(void*) {
+  reportLoopStats();
+}
+
+// Sampled whether or not the broker is reachable; offline samples are
+// kept in the outbox
+void telemetryTick(void*) {
+  publishQueue.request(PUB_TELEMETRY, millis());
+}
+
+// Metrics are a live view; nothing is queued while the broker is away
+void metricsTick(void*) {
+  if (mqttLink.up()) {
+    publishQueue.request(PUB_METRICS, millis());
+  }
+}
+
+// Sends what the outbox collected while offline, a few records per tick so
+// the backlog does not starve live traffic or flood the broker
+static TimerHandle replayTimer = INVALID_TIMER;
+
+void startReplay() {
+  if (outbox.empty() || scheduler.pending(replayTimer)) {
+    return;
+  }
+  LOG_I("OUTBOX", "Replaying %u stored records", (unsigned)outbox.count());
+  replayTimer = scheduler.every(OUTBOX_REPLAY_INTERVAL_MS, replayTick);
+}
+
+void replayTick(void*) {
+  if (!mqttLink.up()) {
+    scheduler.cancel(replayTimer);
+    return;
+  }
+  publishQueue.replay(OUTBOX_REPLAY_BATCH);
+  if (outbox.empty()) {
+    const OutboxStats& st = outbox.stats();
+    LOG_I("OUTBOX", "✓ Replay done (%lu replayed, %lu dropped)", (unsigned long)st.replayed, (unsigned long)st.dropped);
+    scheduler.cancel(replayTimer);
+  }
 }
 
 // ========================================
 // Main Loop
 // ========================================
 void loop() {
-  // WiFi check
+  uint32_t loopStart = micros();
+
+  // Reconnects in the background; startWiFi() ignores repeat calls
   if (WiFi.status() != WL_CONNECTED) {
-    Serial.println("⚠ WiFi disconnected! Reconnecting...");
-    setupWiFi();
+    startWiFi();
   }
   
   // Handle web server requests
-  server.handleClient();
-
-  // MQTT connection with non-blocking reconnect
-  if (!mqttClient.connected()) {
-    unsigned long now = millis();
-    if (now - lastReconnectAttempt > 5000) {
-      lastReconnectAttempt = now;
-      reconnectMQTT();
-    }
-  } else {
+  {
+    MetricTimer timer(httpTime);
+    server.handleClient();
+  }
+  handleEventClients();
+
+  // Connects on its own task; the client is only ours while the link is up
+  mqttLink.poll(millis(), WiFi.status() == WL_CONNECTED);
+  if (mqttLink.up()) {
+    MetricTimer timer(mqttLoopTime);
     mqttClient.loop();
   }
+
+  // Timed LED commands are checked every pass, not on the 10 ms scheduler
+  // tick, so boards apply them within a ms or two of the target
+  if (!pendingCommands.empty()) {
+    pendingCommands.run(epochMs(), applyPendingLEDCommand);
+  }
   
-  // Publish LED status on change
-  if (ledState.changed && mqttClient.connected()) {
-    publishLEDStatus();
+  // LED status goes out once per coalescing window, however many
+  // commands changed it
+  if (ledState.changed) {
+    ledState.changed = false;
+    publishQueue.request(PUB_LED_STATUS, millis());
   }
 
-  if (digitalRead(PIN_BUTTON_ON_BOARD) == LOW) {  // Assuming button pulls LOW when pressed
-  digitalWrite(PIN_BUZZER, HIGH);
-  delay(1000);
-  digitalWrite(PIN_BUZZER, LOW);
+  // Beep once per press (button pulls LOW when pressed)
+  static bool buttonWasPressed = false;
+  bool buttonPressed = digitalRead(PIN_BUTTON_ON_BOARD) == LOW;
+  if (buttonPressed && !buttonWasPressed) {
+    buzz(1000);
+  }
+  buttonWasPressed = buttonPressed;
+
+  scheduler.run(millis());
+  publishQueue.flush(millis());
+  uint32_t loopUs = micros() - loopStart;
+  recordLoopTime(loopUs);
+  loopTime.observe(loopUs);
 }
-  
-}
\ No newline at end of file
@@ -0,0 +1,168 @@
+#include <Arduino.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include "metrics.h"
+#include "httpserver.h"
+#include "publishqueue.h"
+#include "sessionstore.h"
+
+Histogram loopTime;
+Histogram httpTime;
+Histogram mqttLoopTime;
+Histogram stripShowTime;
+
+Histogram::Histogram() : count_(0), sumUs_(0) {
+  for (auto& b : buckets_) {
+    b.store(0, std::memory_order_relaxed);
+  }
+}
+
+void Histogram::observe(uint32_t us) {
+  size_t i = 0;
+  while (i < METRIC_BOUNDS && us > METRIC_BOUNDS_US[i]) {
+    i++;
+  }
+  buckets_[i].fetch_add(1, std::memory_order_relaxed);
+  sumUs_.fetch_add(us, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+MetricTimer::MetricTimer(Histogram& h) : h_(h), start_(micros()) {}
+
+MetricTimer::~MetricTimer() {
+  h_.observe(micros() - start_);
+}
+
+// ========================================
+// Registry
+// ========================================
+enum MetricType : uint8_t { METRIC_COUNTER, METRIC_GAUGE, METRIC_HISTOGRAM };
+
+struct MetricSpec {
+  const char* name;  // Prometheus name
+  const char* key;   // key in the compact MQTT payload
+  MetricType type;
+  const char* help;
+  uint32_t (*sample)();  // counters and gauges
+  const Histogram* histogram;
+};
+
+static uint32_t publishOk() { return publishQueue.stats().published; }
+static uint32_t publishFailed() { return publishQueue.stats().failed; }
+static uint32_t sessionLookups() { return sessions.stats().lookups; }
+static uint32_t sessionMisses() { return sessions.stats().misses; }
+static uint32_t minFreeHeap() { return ESP.getMinFreeHeap(); }
+static uint32_t largestFreeBlock() { return ESP.getMaxAllocHeap(); }
+
+static const MetricSpec METRICS[] = {
+  {"led_loop_duration_seconds", "loop", METRIC_HISTOGRAM, "Time of one loop() pass", nullptr, &loopTime},
+  {"led_http_handle_duration_seconds", "http", METRIC_HISTOGRAM, "Time in server.handleClient()", nullptr, &httpTime},
+  {"led_mqtt_loop_duration_seconds", "mqtt", METRIC_HISTOGRAM, "Time in mqttClient.loop()", nullptr, &mqttLoopTime},
+  {"led_strip_show_duration_seconds", "show", METRIC_HISTOGRAM, "Time in strip.show()", nullptr, &stripShowTime},
+  {"led_mqtt_publishes_total", "pub", METRIC_COUNTER, "MQTT publishes sent", publishOk, nullptr},
+  {"led_mqtt_publish_failures_total", "pub_fail", METRIC_COUNTER, "MQTT publishes that failed", publishFailed, nullptr},
+  {"led_session_lookups_total", "sess", METRIC_COUNTER, "Web session lookups", sessionLookups, nullptr},
+  {"led_session_lookup_misses_total", "sess_miss", METRIC_COUNTER, "Web session lookups without a live session",
+   sessionMisses, nullptr},
+  {"led_heap_min_free_bytes", "heap_min", METRIC_GAUGE, "Lowest free heap since boot", minFreeHeap, nullptr},
+  {"led_heap_largest_free_block_bytes", "heap_block", METRIC_GAUGE, "Largest allocatable heap block",
+   largestFreeBlock, nullptr},
+};
+
+static const char* const METRIC_TYPE_NAMES[] = {"counter", "gauge", "histogram"};
+
+// Microseconds as a decimal number of seconds without trailing zeros
+static void formatSeconds(char* out, size_t len, uint64_t us) {
+  int n = snprintf(out, len, "%llu.%06u", (unsigned long long)(us / 1000000), (unsigned)(us % 1000000));
+  while (n > 0 && out[n - 1] == '0') {
+    out[--n] = '\0';
+  }
+  if (n > 0 && out[n - 1] == '.') {
+    out[--n] = '\0';
+  }
+}
+
+// One line group per call to producePrometheus(): the HELP/TYPE lines and
+// value of a metric, or a single histogram bucket, or the +Inf, sum and
+// count lines. cursor.next is metric index * PARTS + part.
+static const uint32_t PARTS = METRIC_BOUNDS + 2;
+
+static int formatPart(const MetricSpec& m, uint32_t part, char* buf, size_t len) {
+  if (part == 0) {
+    int n = snprintf(buf, len, "# HELP %s %s\n# TYPE %s %s\n", m.name, m.help, m.name, METRIC_TYPE_NAMES[m.type]);
+    if (m.type != METRIC_HISTOGRAM && n > 0 && (size_t)n < len) {
+      n += snprintf(buf + n, len - n, "%s %lu\n", m.name, (unsigned long)m.sample());
+    }
+    return n;
+  }
+
+  // Cumulative from the per-bucket counts, so +Inf and _count agree even
+  // if a sample lands mid-scrape
+  const Histogram& h = *m.histogram;
+  uint32_t cumulative = 0;
+  for (size_t i = 0; i < part && i <= METRIC_BOUNDS; i++) {
+    cumulative += h.bucket(i);
+  }
+  char seconds[24];
+  if (part <= METRIC_BOUNDS) {
+    formatSeconds(seconds, sizeof(seconds), METRIC_BOUNDS_US[part - 1]);
+    return snprintf(buf, len, "%s_bucket{le=\"%s\"} %lu\n", m.name, seconds, (unsigned long)cumulative);
+  }
+  formatSeconds(seconds, sizeof(seconds), h.sumUs());
+  return snprintf(buf, len, "%s_bucket{le=\"+Inf\"} %lu\n%s_sum %s\n%s_count %lu\n", m.name,
+                  (unsigned long)cumulative, m.name, seconds, m.name, (unsigned long)cumulative);
+}
+
+static bool producePrometheus(HttpServer& server, HttpServer::StreamCursor& cursor) {
+  char line[256];
+  const size_t count = sizeof(METRICS) / sizeof(METRICS[0]);
+  while (cursor.next / PARTS < count) {
+    const MetricSpec& m = METRICS[cursor.next / PARTS];
+    uint32_t part = cursor.next % PARTS;
+    int n = formatPart(m, part, line, sizeof(line));
+    if (n >= (int)sizeof(line)) {
+      n = sizeof(line) - 1;
+    }
+    if (server.room() < (size_t)n) {
+      return true;
+    }
+    server.sendContent(line, n);
+    cursor.next = m.type == METRIC_HISTOGRAM && part + 1 < PARTS ? cursor.next + 1 : (cursor.next / PARTS + 1) * PARTS;
+  }
+  return false;
+}
+
+void writePrometheusMetrics(HttpServer& server) {
+  server.sendStream(200, "text/plain; version=0.0.4; charset=utf-8", producePrometheus);
+}
+
+// Appends like snprintf and keeps the full length, so the caller can
+// tell the payload was cut short
+static void append(char* buf, size_t len, size_t& used, const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(buf + (used < len ? used : len), used < len ? len - used : 0, fmt, args);
+  va_end(args);
+  if (n > 0) {
+    used += n;
+  }
+}
+
+int buildMetrics(char* buf, size_t len) {
+  size_t used = 0;
+  append(buf, len, used, "{\"device\":\"%s\"", DEVICE_NAME);
+  for (const MetricSpec& m : METRICS) {
+    if (m.type != METRIC_HISTOGRAM) {
+      append(buf, len, used, ",\"%s\":%lu", m.key, (unsigned long)m.sample());
+      continue;
+    }
+    const Histogram& h = *m.histogram;
+    append(buf, len, used, ",\"%s\":[%lu,%llu", m.key, (unsigned long)h.count(), (unsigned long long)h.sumUs());
+    for (size_t i = 0; i <= METRIC_BOUNDS; i++) {
+      append(buf, len, used, ",%lu", (unsigned long)h.bucket(i));
+    }
+    append(buf, len, used, "]");
+  }
+  append(buf, len, used, "}");
+  return (int)used;
+}
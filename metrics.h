@@ -0,0 +1,68 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "config.h"
+
+// Runtime metrics for monitoring: counters, gauges and fixed-bucket
+// histograms, listed once in the registry in metrics.cpp and rendered two
+// ways:
+//
+//   /metrics (Prometheus text)   led_loop_duration_seconds_bucket{le="0.0001"} 812
+//   MQTT_TOPIC_METRICS (JSON)    {"device":"...","loop":[count,sum_us,b0,...],"pub":12,...}
+//
+// Histograms are fed by the code being timed, in microseconds, and share
+// the bounds in METRIC_BUCKETS_US. Counters and gauges are sampled from the
+// modules that already keep them when the metrics are rendered, so those
+// modules do not depend on this one.
+
+static const uint32_t METRIC_BOUNDS_US[] = METRIC_BUCKETS_US;
+static const size_t METRIC_BOUNDS = sizeof(METRIC_BOUNDS_US) / sizeof(METRIC_BOUNDS_US[0]);
+
+// Observed from one task, read from another; relaxed atomics are enough
+// since a scrape may land between a sample's bucket and its count. Counts
+// are 32-bit and an idle loop() wraps them within a day or so, which
+// Prometheus treats as a counter reset.
+class Histogram {
+ public:
+  Histogram();
+
+  void observe(uint32_t us);
+
+  uint32_t count() const { return count_.load(std::memory_order_relaxed); }
+  uint64_t sumUs() const { return sumUs_.load(std::memory_order_relaxed); }
+  // Samples in bucket i alone (not cumulative); i == METRIC_BOUNDS is +Inf
+  uint32_t bucket(size_t i) const { return buckets_[i].load(std::memory_order_relaxed); }
+
+ private:
+  std::atomic<uint32_t> buckets_[METRIC_BOUNDS + 1];
+  std::atomic<uint32_t> count_;
+  std::atomic<uint64_t> sumUs_;
+};
+
+extern Histogram loopTime;       // one loop() pass
+extern Histogram httpTime;       // server.handleClient()
+extern Histogram mqttLoopTime;   // mqttClient.loop()
+extern Histogram stripShowTime;  // strip.show() on the render task
+
+// Times the enclosing scope into a histogram
+class MetricTimer {
+ public:
+  explicit MetricTimer(Histogram& h);
+  ~MetricTimer();
+
+ private:
+  Histogram& h_;
+  uint32_t start_;
+};
+
+class HttpServer;
+
+// Streams the registry as Prometheus text exposition format (0.0.4)
+void writePrometheusMetrics(HttpServer& server);
+// Compact JSON for the MQTT metrics topic; a PublishBuilder
+int buildMetrics(char* buf, size_t len);
+
+#endif // METRICS_H
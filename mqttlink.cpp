@@ -0,0 +1,117 @@
+#include "mqttlink.h"
+#include <Arduino.h>
+#include "log.h"
+
+MqttLink mqttLink;
+
+MqttLink::MqttLink()
+    : client_(nullptr), connect_(nullptr), onUp_(nullptr), onDown_(nullptr), diagnose_(nullptr), task_(nullptr),
+      state_(LINK_WAITING), nextAttemptMs_(0), downSinceMs_(0), result_(RESULT_NONE), diagnosticsWanted_(true),
+      stats_() {}
+
+void MqttLink::begin(PubSubClient& client, ConnectFn connect, EventFn onUp, EventFn onDown, EventFn diagnose) {
+  client_ = &client;
+  connect_ = connect;
+  onUp_ = onUp;
+  onDown_ = onDown;
+  diagnose_ = diagnose;
+  if (task_ == nullptr) {
+    xTaskCreate(taskEntry, "mqtt_connect", MQTT_CONNECT_TASK_STACK, this, MQTT_CONNECT_TASK_PRIORITY, &task_);
+  }
+}
+
+void MqttLink::taskEntry(void* arg) {
+  MqttLink* link = (MqttLink*)arg;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    link->attempt();
+  }
+}
+
+// Connect task: everything in here may block for seconds
+void MqttLink::attempt() {
+  if (diagnosticsWanted_.exchange(false) && diagnose_ != nullptr) {
+    diagnose_();
+  }
+  uint32_t start = millis();
+  bool ok = connect_();
+  stats_.lastConnectMs = millis() - start;
+  result_.store(ok ? RESULT_OK : RESULT_FAILED, std::memory_order_release);
+}
+
+void MqttLink::poll(uint32_t nowMs, bool networkUp) {
+  switch (state_) {
+    case LINK_UP:
+      if (!client_->connected()) {
+        LOG_W("MQTT", "✗ Connection lost (state %d)", client_->state());
+        downSinceMs_ = nowMs;
+        stats_.consecutiveFailures = 0;
+        scheduleRetry(nowMs);
+        if (onDown_ != nullptr) {
+          onDown_();
+        }
+      }
+      break;
+
+    case LINK_WAITING:
+      if (networkUp && (int32_t)(nowMs - nextAttemptMs_) >= 0) {
+        state_ = LINK_CONNECTING;
+        stats_.attempts++;
+        result_.store(RESULT_NONE, std::memory_order_relaxed);
+        xTaskNotifyGive(task_);
+      }
+      break;
+
+    case LINK_CONNECTING: {
+      uint8_t result = result_.load(std::memory_order_acquire);
+      if (result == RESULT_NONE) {
+        break;
+      }
+      if (stats_.lastConnectMs > stats_.maxConnectMs) {
+        stats_.maxConnectMs = stats_.lastConnectMs;
+      }
+      if (result == RESULT_OK) {
+        state_ = LINK_UP;
+        stats_.connects++;
+        stats_.consecutiveFailures = 0;
+        stats_.backoffMs = 0;
+        stats_.lastOutageMs = nowMs - downSinceMs_;
+        LOG_I("MQTT", "✓ Connected in %lu ms after %lu ms down", (unsigned long)stats_.lastConnectMs,
+              (unsigned long)stats_.lastOutageMs);
+        if (onUp_ != nullptr) {
+          onUp_();
+        }
+      } else {
+        stats_.failures++;
+        stats_.consecutiveFailures++;
+        stats_.lastError = client_->state();
+        if (stats_.consecutiveFailures % MQTT_DIAGNOSTICS_EVERY == 0) {
+          diagnosticsWanted_ = true;
+        }
+        scheduleRetry(nowMs);
+      }
+      break;
+    }
+  }
+}
+
+// Full delay doubles per consecutive failure; the actual wait is drawn
+// from its upper half
+void MqttLink::scheduleRetry(uint32_t nowMs) {
+  uint32_t ceiling = MQTT_BACKOFF_MIN_MS;
+  for (uint32_t i = 1; i < stats_.consecutiveFailures && ceiling < MQTT_BACKOFF_MAX_MS; i++) {
+    ceiling *= 2;
+  }
+  if (ceiling > MQTT_BACKOFF_MAX_MS) {
+    ceiling = MQTT_BACKOFF_MAX_MS;
+  }
+  // The first retry after a drop also gets jitter, so devices that lost
+  // the broker together do not all come back at once
+  stats_.backoffMs = ceiling / 2 + random(ceiling / 2 + 1);
+  nextAttemptMs_ = nowMs + stats_.backoffMs;
+  state_ = LINK_WAITING;
+  if (stats_.consecutiveFailures > 0) {
+    LOG_W("MQTT", "Retry #%lu in %lu ms (error %d)", (unsigned long)stats_.consecutiveFailures,
+          (unsigned long)stats_.backoffMs, stats_.lastError);
+  }
+}
@@ -0,0 +1,81 @@
+#ifndef MQTTLINK_H
+#define MQTTLINK_H
+
+#include <stdint.h>
+#include <atomic>
+#include <PubSubClient.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "config.h"
+
+// Keeps the MQTT connection up without blocking loop(). DNS, the TCP
+// connect and the wait for CONNACK run on a separate connect task; loop()
+// only calls poll(), which reads the task's result and decides when the
+// next attempt starts. Retries back off exponentially from
+// MQTT_BACKOFF_MIN_MS to MQTT_BACKOFF_MAX_MS, each delay randomized to
+// between half and all of its value so a fleet does not reconnect in step
+// after a broker restart.
+//
+// While an attempt is running the task owns the PubSubClient; loop() must
+// only touch it while up() is true.
+
+enum MqttLinkState : uint8_t {
+  LINK_WAITING,     // backing off until the next attempt
+  LINK_CONNECTING,  // attempt running on the connect task
+  LINK_UP
+};
+
+struct MqttLinkStats {
+  uint32_t attempts;
+  uint32_t failures;             // total failed attempts
+  uint32_t consecutiveFailures;  // since the last successful connect
+  uint32_t connects;
+  uint32_t lastConnectMs;  // duration of the last attempt
+  uint32_t maxConnectMs;
+  uint32_t backoffMs;      // delay before the pending retry
+  uint32_t lastOutageMs;   // link down until it was back up
+  int lastError;           // PubSubClient state() after the last failure
+};
+
+class MqttLink {
+ public:
+  typedef bool (*ConnectFn)();  // runs on the connect task
+  typedef void (*EventFn)();    // runs on loop()
+
+  MqttLink();
+
+  // diagnose runs on the connect task before the first attempt, after
+  // every MQTT_DIAGNOSTICS_EVERY failures, and on requestDiagnostics()
+  void begin(PubSubClient& client, ConnectFn connect, EventFn onUp, EventFn onDown, EventFn diagnose);
+  void poll(uint32_t nowMs, bool networkUp);
+  void requestDiagnostics() { diagnosticsWanted_ = true; }
+
+  bool up() const { return state_ == LINK_UP; }
+  MqttLinkState state() const { return state_; }
+  const MqttLinkStats& stats() const { return stats_; }
+
+ private:
+  enum Result : uint8_t { RESULT_NONE, RESULT_OK, RESULT_FAILED };
+
+  static void taskEntry(void* arg);
+  void attempt();
+  void scheduleRetry(uint32_t nowMs);
+
+  PubSubClient* client_;
+  ConnectFn connect_;
+  EventFn onUp_;
+  EventFn onDown_;
+  EventFn diagnose_;
+  TaskHandle_t task_;
+
+  MqttLinkState state_;
+  uint32_t nextAttemptMs_;
+  uint32_t downSinceMs_;
+  std::atomic<uint8_t> result_;
+  std::atomic<bool> diagnosticsWanted_;
+  MqttLinkStats stats_;
+};
+
+extern MqttLink mqttLink;
+
+#endif // MQTTLINK_H
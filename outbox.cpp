@@ -0,0 +1,216 @@
+#include "outbox.h"
+#include <string.h>
+#include "log.h"
+
+Outbox outbox;
+
+static const char* OUTBOX_PATH = "/outbox.bin";
+static const char* OUTBOX_INDEX_PATH = "/outbox.idx";
+static const uint32_t OUTBOX_MAGIC = 0x4F425832;  // "OBX2"
+static const uint32_t SLOT_BYTES = sizeof(uint32_t) + sizeof(OutboxRecord);
+
+Outbox::Outbox()
+    : ramHead_(0), ramCount_(0), fileHeadSeq_(1), fileCount_(0), indexDirty_(false), loadedSeq_(0), stats_() {}
+
+bool Outbox::begin() {
+  if (!LittleFS.begin(true)) {
+    LOG_W("OUTBOX", "✗ LittleFS mount failed, buffering in RAM only");
+    return false;
+  }
+  if (!openFile()) {
+    LOG_W("OUTBOX", "✗ Cannot create %s, buffering in RAM only", OUTBOX_PATH);
+    file_.close();
+    return false;
+  }
+  LOG_I("OUTBOX", "✓ %u records pending from before restart", fileCount_);
+  return true;
+}
+
+// Reuses the file if it was written with the same geometry, else starts over
+bool Outbox::openFile() {
+  FileHeader h = {};
+  File f = LittleFS.open(OUTBOX_PATH, "r+");
+  if (f && f.read((uint8_t*)&h, sizeof(h)) == sizeof(h) && h.magic == OUTBOX_MAGIC &&
+      h.slots == OUTBOX_FILE_RECORDS && h.payloadMax == OUTBOX_PAYLOAD_MAX) {
+    file_ = f;
+    uint32_t newest = 0;
+    for (uint16_t slot = 0; slot < OUTBOX_FILE_RECORDS; slot++) {
+      uint32_t seq = slotSeq(slot);
+      if (seq > newest) {
+        newest = seq;
+      }
+    }
+
+    IndexFile idx = {};
+    File fi = LittleFS.open(OUTBOX_INDEX_PATH, "r");
+    uint32_t saved = fi && fi.read((uint8_t*)&idx, sizeof(idx)) == sizeof(idx) && idx.magic == OUTBOX_MAGIC
+                         ? idx.headSeq
+                         : 1;
+    fi.close();
+
+    // Records older than one ring turn were overwritten
+    uint32_t head = saved > 0 ? saved : 1;
+    if (newest >= OUTBOX_FILE_RECORDS && head < newest - OUTBOX_FILE_RECORDS + 1) {
+      head = newest - OUTBOX_FILE_RECORDS + 1;
+    }
+    if (head > newest) {
+      head = newest + 1;
+    }
+    fileHeadSeq_ = head;
+    fileCount_ = newest + 1 - head;
+    // New records must not land behind a stale saved position
+    indexDirty_ = head != saved;
+    sync();
+    return true;
+  }
+
+  f.close();
+  LittleFS.remove(OUTBOX_INDEX_PATH);
+  file_ = LittleFS.open(OUTBOX_PATH, "w+");
+  fileHeadSeq_ = 1;
+  fileCount_ = 0;
+  h = {OUTBOX_MAGIC, OUTBOX_FILE_RECORDS, OUTBOX_PAYLOAD_MAX};
+  if (!file_ || file_.write((const uint8_t*)&h, sizeof(h)) != sizeof(h)) {
+    return false;
+  }
+  file_.flush();
+  return true;
+}
+
+bool Outbox::push(uint8_t kind, const char* payload, size_t length) {
+  if (length > OUTBOX_PAYLOAD_MAX) {
+    LOG_W("OUTBOX", "✗ %u byte record too large, dropped", (unsigned)length);
+    stats_.dropped++;
+    return false;
+  }
+
+  if (ramCount_ == OUTBOX_RAM_RECORDS && !spillOldest()) {
+    // Nowhere to put the oldest RAM record
+    if (OUTBOX_DROP_POLICY == OUTBOX_DROP_NEWEST) {
+      stats_.dropped++;
+      return false;
+    }
+    ramHead_ = (ramHead_ + 1) % OUTBOX_RAM_RECORDS;
+    ramCount_--;
+    stats_.dropped++;
+  }
+
+  OutboxRecord& rec = ram_[(ramHead_ + ramCount_) % OUTBOX_RAM_RECORDS];
+  rec.kind = kind;
+  rec.reserved = 0;
+  rec.length = length;
+  memcpy(rec.payload, payload, length);
+  ramCount_++;
+  stats_.stored++;
+  return true;
+}
+
+// Moves the oldest RAM record to the end of the file ring. A full file
+// either loses its oldest slot or refuses, depending on the drop policy.
+bool Outbox::spillOldest() {
+  if (!file_) {
+    return false;
+  }
+  if (fileCount_ == OUTBOX_FILE_RECORDS) {
+    if (OUTBOX_DROP_POLICY == OUTBOX_DROP_NEWEST) {
+      return false;
+    }
+    dropFileHead();
+    stats_.dropped++;
+  }
+
+  if (!writeSlot(fileHeadSeq_ + fileCount_, ram_[ramHead_])) {
+    LOG_W("OUTBOX", "✗ Flash write failed");
+    return false;
+  }
+  fileCount_++;
+
+  ramHead_ = (ramHead_ + 1) % OUTBOX_RAM_RECORDS;
+  ramCount_--;
+  stats_.spilled++;
+  return true;
+}
+
+const OutboxRecord* Outbox::peek(size_t index) {
+  if (index < fileCount_) {
+    uint32_t seq = fileHeadSeq_ + index;
+    while (loadedSeq_ != seq) {
+      if (readSlot(seq, loaded_)) {
+        loadedSeq_ = seq;
+        break;
+      }
+      if (index > 0) {
+        return nullptr;  // dropped once it is the oldest
+      }
+      // Unreadable oldest slot: skip it rather than stall the replay
+      dropFileHead();
+      if (fileCount_ == 0) {
+        return peek(0);
+      }
+      seq = fileHeadSeq_;
+    }
+    return &loaded_;
+  }
+  index -= fileCount_;
+  return index < ramCount_ ? &ram_[(ramHead_ + index) % OUTBOX_RAM_RECORDS] : nullptr;
+}
+
+void Outbox::pop(size_t n) {
+  for (; n > 0; n--) {
+    if (fileCount_ > 0) {
+      dropFileHead();
+    } else if (ramCount_ > 0) {
+      ramHead_ = (ramHead_ + 1) % OUTBOX_RAM_RECORDS;
+      ramCount_--;
+    } else {
+      break;
+    }
+  }
+}
+
+void Outbox::sync() {
+  if (!indexDirty_ || !file_) {
+    return;
+  }
+  IndexFile idx = {OUTBOX_MAGIC, fileHeadSeq_};
+  File f = LittleFS.open(OUTBOX_INDEX_PATH, "w");
+  if (f && f.write((const uint8_t*)&idx, sizeof(idx)) == sizeof(idx)) {
+    indexDirty_ = false;
+  } else {
+    LOG_W("OUTBOX", "✗ Cannot write %s", OUTBOX_INDEX_PATH);
+  }
+  f.close();
+}
+
+void Outbox::dropFileHead() {
+  fileHeadSeq_++;
+  fileCount_--;
+  indexDirty_ = true;
+}
+
+bool Outbox::writeSlot(uint32_t seq, const OutboxRecord& rec) {
+  if (!file_.seek(sizeof(FileHeader) + (seq % OUTBOX_FILE_RECORDS) * SLOT_BYTES) ||
+      file_.write((const uint8_t*)&seq, sizeof(seq)) != sizeof(seq) ||
+      file_.write((const uint8_t*)&rec, sizeof(rec)) != sizeof(rec)) {
+    return false;
+  }
+  file_.flush();
+  return true;
+}
+
+bool Outbox::readSlot(uint32_t seq, OutboxRecord& rec) {
+  uint32_t stored = 0;
+  return file_.seek(sizeof(FileHeader) + (seq % OUTBOX_FILE_RECORDS) * SLOT_BYTES) &&
+         file_.read((uint8_t*)&stored, sizeof(stored)) == sizeof(stored) && stored == seq &&
+         file_.read((uint8_t*)&rec, sizeof(rec)) == sizeof(rec) && rec.length <= OUTBOX_PAYLOAD_MAX;
+}
+
+// 0 for a slot that was never written
+uint32_t Outbox::slotSeq(uint16_t slot) {
+  uint32_t seq = 0;
+  if (!file_.seek(sizeof(FileHeader) + (uint32_t)slot * SLOT_BYTES) ||
+      file_.read((uint8_t*)&seq, sizeof(seq)) != sizeof(seq)) {
+    return 0;
+  }
+  return seq;
+}
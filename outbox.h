@@ -0,0 +1,102 @@
+#ifndef OUTBOX_H
+#define OUTBOX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <LittleFS.h>
+#include "config.h"
+
+// Store-and-forward buffer for publishes made while the broker is away.
+// New records go into a RAM ring; when that is full the oldest RAM record
+// moves to a ring file on LittleFS, so the file always holds the oldest
+// data and RAM the newest. Replay drains the file first, then RAM, which
+// keeps the original order. When both are full OUTBOX_DROP_POLICY decides
+// whether the oldest stored record or the new one is lost.
+//
+// The file is a small header, written once when the file is created,
+// followed by OUTBOX_FILE_RECORDS fixed-size slots. Each slot carries a
+// sequence number and record n always lives in slot n % OUTBOX_FILE_RECORDS,
+// so the newest record is found by scanning the slots at begin(). Only the
+// replay position is kept elsewhere, in a small index file that sync()
+// rewrites once per replay batch; a pop itself never touches flash. After
+// a reboot at most the last unsynced batch is sent a second time.
+//
+// Only records that overflow RAM touch flash, one slot per record.
+
+#define OUTBOX_DROP_OLDEST 0
+#define OUTBOX_DROP_NEWEST 1
+
+struct OutboxRecord {
+  uint8_t kind;  // PublishKind
+  uint8_t reserved;
+  uint16_t length;
+  char payload[OUTBOX_PAYLOAD_MAX];
+};
+
+struct OutboxStats {
+  uint32_t stored;
+  uint32_t spilled;   // moved from RAM to flash
+  uint32_t dropped;
+  uint32_t replayed;
+};
+
+class Outbox {
+ public:
+  Outbox();
+
+  // Mounts LittleFS and picks up records left from before a reboot.
+  // Without a file system the outbox keeps working from RAM only.
+  bool begin();
+
+  bool push(uint8_t kind, const char* payload, size_t length);
+  // The index-th oldest record, or nullptr past the end or at an
+  // unreadable slot; valid until the next call
+  const OutboxRecord* peek(size_t index);
+  const OutboxRecord* front() { return peek(0); }
+  // Drops the n oldest records
+  void pop(size_t n = 1);
+  // Persists the replay position if pops or drops moved it
+  void sync();
+
+  size_t count() const { return ramCount_ + fileCount_; }
+  bool empty() const { return count() == 0; }
+  uint16_t fileCount() const { return fileCount_; }
+  const OutboxStats& stats() const { return stats_; }
+  void countReplayed(uint32_t n) { stats_.replayed += n; }
+
+ private:
+  struct FileHeader {
+    uint32_t magic;
+    uint16_t slots;
+    uint16_t payloadMax;
+  };
+
+  struct IndexFile {
+    uint32_t magic;
+    uint32_t headSeq;
+  };
+
+  bool openFile();
+  void dropFileHead();
+  bool writeSlot(uint32_t seq, const OutboxRecord& rec);
+  bool readSlot(uint32_t seq, OutboxRecord& rec);
+  uint32_t slotSeq(uint16_t slot);
+  bool spillOldest();
+
+  OutboxRecord ram_[OUTBOX_RAM_RECORDS];
+  uint8_t ramHead_;
+  uint8_t ramCount_;
+
+  File file_;
+  uint32_t fileHeadSeq_;  // sequence number of the oldest file record
+  uint16_t fileCount_;
+  bool indexDirty_;
+
+  OutboxRecord loaded_;
+  uint32_t loadedSeq_;  // 0 when loaded_ holds nothing
+  OutboxStats stats_;
+};
+
+extern Outbox outbox;
+
+#endif // OUTBOX_H
@@ -0,0 +1,74 @@
+#include "pendingcommands.h"
+#include <string.h>
+
+PendingCommands pendingCommands;
+
+PendingCommands::PendingCommands() : entries_(), nextMs_(INT64_MAX), sequence_(0), count_(0), stats_() {}
+
+bool PendingCommands::add(const char* payload, size_t length, int segment, int64_t atMs) {
+  if (length > PENDING_COMMAND_MAX) {
+    stats_.rejected++;
+    return false;
+  }
+  for (Entry& e : entries_) {
+    if (e.used) {
+      continue;
+    }
+    memcpy(e.payload, payload, length);
+    e.length = length;
+    e.segment = segment;
+    e.atMs = atMs;
+    e.sequence = sequence_++;
+    e.used = true;
+    count_++;
+    stats_.scheduled++;
+    if (atMs < nextMs_) {
+      nextMs_ = atMs;
+    }
+    return true;
+  }
+  stats_.rejected++;
+  return false;
+}
+
+int PendingCommands::earliest() const {
+  int best = -1;
+  for (int i = 0; i < PENDING_COMMAND_SLOTS; i++) {
+    const Entry& e = entries_[i];
+    if (!e.used) {
+      continue;
+    }
+    if (best < 0 || e.atMs < entries_[best].atMs ||
+        (e.atMs == entries_[best].atMs && (int32_t)(e.sequence - entries_[best].sequence) < 0)) {
+      best = i;
+    }
+  }
+  return best;
+}
+
+void PendingCommands::run(int64_t nowMs, PendingApply apply) {
+  while (count_ > 0 && nowMs >= nextMs_) {
+    int i = earliest();
+    Entry& e = entries_[i];
+    int64_t late = nowMs - e.atMs;
+    stats_.lastLateMs = late > INT32_MAX ? INT32_MAX : (int32_t)late;
+    if (stats_.lastLateMs > stats_.maxLateMs) {
+      stats_.maxLateMs = stats_.lastLateMs;
+    }
+    stats_.applied++;
+    apply(e.payload, e.length, e.segment, stats_.lastLateMs);
+
+    e.used = false;
+    count_--;
+    int next = earliest();
+    nextMs_ = next < 0 ? INT64_MAX : entries_[next].atMs;
+  }
+}
+
+void PendingCommands::clear() {
+  for (Entry& e : entries_) {
+    e.used = false;
+  }
+  count_ = 0;
+  nextMs_ = INT64_MAX;
+}
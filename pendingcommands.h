@@ -0,0 +1,66 @@
+#ifndef PENDINGCOMMANDS_H
+#define PENDINGCOMMANDS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+
+// LED commands waiting for their {"at": epoch ms} target time. The broker
+// delivers a group command to each board at a slightly different moment;
+// holding it until a shared wall-clock time (clocksync.h) makes the whole
+// group change together instead of rippling.
+//
+// The payload is copied, since PubSubClient reuses its buffer, and parsed
+// again when it comes due. run() is polled from loop() and costs one
+// comparison while nothing is due. Commands with the same target apply in
+// arrival order; a target already in the past applies on the next run().
+
+struct PendingCommandStats {
+  uint32_t scheduled;
+  uint32_t applied;
+  uint32_t rejected;  // queue full or payload too long
+  int32_t lastLateMs;  // apply time - target of the last command
+  int32_t maxLateMs;
+};
+
+// Called with the stored payload once it is due
+typedef void (*PendingApply)(const char* payload, size_t length, int segment, int32_t lateMs);
+
+class PendingCommands {
+ public:
+  PendingCommands();
+
+  // False (and nothing queued) if the queue is full or the payload does
+  // not fit a slot
+  bool add(const char* payload, size_t length, int segment, int64_t atMs);
+
+  // Applies everything due at nowMs, earliest target first
+  void run(int64_t nowMs, PendingApply apply);
+
+  void clear();
+  bool empty() const { return count_ == 0; }
+  uint8_t size() const { return count_; }
+  const PendingCommandStats& stats() const { return stats_; }
+
+ private:
+  struct Entry {
+    int64_t atMs;
+    uint32_t sequence;
+    uint16_t length;
+    int16_t segment;
+    bool used;
+    char payload[PENDING_COMMAND_MAX];
+  };
+
+  int earliest() const;
+
+  Entry entries_[PENDING_COMMAND_SLOTS];
+  int64_t nextMs_;  // target of the earliest entry
+  uint32_t sequence_;
+  uint8_t count_;
+  PendingCommandStats stats_;
+};
+
+extern PendingCommands pendingCommands;
+
+#endif // PENDINGCOMMANDS_H
@@ -0,0 +1,159 @@
+#include "publishqueue.h"
+#include <string.h>
+#include "log.h"
+
+PublishQueue::PublishQueue(PubSubClient& mqtt, CorkedClient& net, Outbox& outbox)
+    : mqtt_(mqtt), net_(net), outbox_(outbox), pending_(0), online_(false), stats_() {
+  memset(slots_, 0, sizeof(slots_));
+}
+
+void PublishQueue::define(PublishKind kind, const char* topic, bool retained, PublishBuilder build, bool store) {
+  slots_[kind].topic = topic;
+  slots_[kind].retained = retained;
+  slots_[kind].store = store;
+  slots_[kind].build = build;
+}
+
+void PublishQueue::request(PublishKind kind, uint32_t nowMs) {
+  if (pending(kind)) {
+    stats_.coalesced++;
+    return;
+  }
+  // The window starts at the first request, so a steady stream of updates
+  // still goes out every MQTT_COALESCE_MS
+  pending_ |= 1u << kind;
+  slots_[kind].requestedAt = nowMs;
+}
+
+uint8_t PublishQueue::flush(uint32_t nowMs) {
+  if (pending_ == 0) {
+    return 0;
+  }
+
+  bool online = online_;
+  uint8_t sent = 0;
+  uint8_t held = 0;  // kinds still in the cork buffer, not yet on the wire
+  uint8_t heldCount = 0;
+  bool corked = false;
+  for (uint8_t k = 0; k < PUB_KIND_COUNT; k++) {
+    Slot& s = slots_[k];
+    if (!pending((PublishKind)k) || nowMs - s.requestedAt < MQTT_COALESCE_MS) {
+      continue;
+    }
+    // Samples go to the outbox while offline, and also while a replay is
+    // still running so they stay in order; state kinds wait for the link
+    if (s.store && (!online || !outbox_.empty())) {
+      pending_ &= ~(1u << k);
+      int len = s.build != nullptr ? s.build(buf_, sizeof(buf_)) : 0;
+      if (len > 0 && len < (int)sizeof(buf_)) {
+        outbox_.push(k, buf_, len);
+      }
+      continue;
+    }
+    if (!online) {
+      continue;
+    }
+    if (!corked) {
+      net_.cork();
+      corked = true;
+    }
+
+    pending_ &= ~(1u << k);
+    int len = s.build != nullptr ? s.build(buf_, sizeof(buf_)) : 0;
+    if (len <= 0) {
+      continue;
+    }
+    if (len >= (int)sizeof(buf_)) {
+      LOG_W("MQTT", "✗ Payload for %s truncated (%d bytes)", s.topic, len);
+      len = sizeof(buf_) - 1;
+    }
+    uint16_t drains = net_.drains();
+    if (mqtt_.publish(s.topic, (const uint8_t*)buf_, len, s.retained)) {
+      if (net_.drains() != drains) {
+        held = 0;
+        heldCount = 0;
+      }
+      if (net_.held() > 0) {
+        held |= 1u << k;
+        heldCount++;
+      }
+      sent++;
+      LOG_D("MQTT", "✓ Published %s (%d bytes)", s.topic, len);
+    } else {
+      stats_.failed++;
+      LOG_W("MQTT", "✗ Failed to publish %s", s.topic);
+      if (s.store) {
+        outbox_.push(k, buf_, len);
+      } else {
+        pending_ |= 1u << k;
+      }
+      break;
+    }
+  }
+
+  // The cork only buffers, so a publish is not out until it drained. A
+  // short write may leave half a packet on the wire, so the client is
+  // stopped and MqttLink reconnects; the kinds that were still held are
+  // requested again, and samples are rebuilt rather than lost.
+  if (corked) {
+    stats_.batches++;
+    if (!net_.uncork()) {
+      LOG_W("MQTT", "✗ Short write flushing %u publishes, reconnecting", sent);
+      dropConnection();
+      pending_ |= held;
+      stats_.failed += heldCount;
+      stats_.published += sent - heldCount;
+      return sent - heldCount;
+    }
+    stats_.published += sent;
+  }
+  return sent;
+}
+
+void PublishQueue::dropConnection() {
+  net_.stop();
+  online_ = false;
+}
+
+uint8_t PublishQueue::replay(uint8_t maxRecords) {
+  if (!online_) {
+    return 0;
+  }
+
+  // Records leave the outbox once they are on the wire: at a mid-batch
+  // drain for the ones before it, at uncork() for the rest. A short write
+  // keeps the records that were still held and drops the connection.
+  uint8_t sent = 0;
+  uint8_t out = 0;  // records known to be on the wire
+  net_.cork();
+  const OutboxRecord* rec;
+  while (sent < maxRecords && (rec = outbox_.peek(sent)) != nullptr) {
+    const Slot& s = slots_[rec->kind < PUB_KIND_COUNT ? rec->kind : (uint8_t)PUB_TELEMETRY];
+    uint16_t drains = net_.drains();
+    if (!mqtt_.publish(s.topic, (const uint8_t*)rec->payload, rec->length, s.retained)) {
+      stats_.failed++;
+      break;
+    }
+    if (net_.drains() != drains) {
+      out = sent;
+    }
+    sent++;
+    if (net_.held() == 0) {
+      out = sent;
+    }
+  }
+  if (!net_.uncork()) {
+    LOG_W("OUTBOX", "✗ Short write replaying %u records, keeping %u", sent, sent - out);
+    dropConnection();
+    stats_.failed += sent - out;
+    sent = out;
+  }
+  if (sent > 0) {
+    outbox_.pop(sent);
+    outbox_.countReplayed(sent);
+    outbox_.sync();
+    stats_.published += sent;
+    stats_.batches++;
+  }
+  return sent;
+}
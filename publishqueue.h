@@ -0,0 +1,84 @@
+#ifndef PUBLISHQUEUE_H
+#define PUBLISHQUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <PubSubClient.h>
+#include "config.h"
+#include "corkedclient.h"
+#include "outbox.h"
+
+// Outbound MQTT publishes, coalesced per message kind. Callers only mark a
+// kind as wanted; its payload is built when the queue is flushed, so every
+// update inside one MQTT_COALESCE_MS window ends up as a single publish of
+// the latest state. A flush sends all due kinds corked into one write.
+//
+// Kinds defined with store=true are samples rather than state: while the
+// broker is unreachable they are built anyway and kept in the outbox, and
+// replay() sends them later in their original order.
+
+enum PublishKind : uint8_t {
+  PUB_LED_STATUS,     // retained LED state
+  PUB_DEVICE_STATUS,  // ip, rssi, heap, ...
+  PUB_TELEMETRY,      // periodic data, every PUBLISH_INTERVAL
+  PUB_METRICS,        // metrics.h, every METRICS_PUBLISH_INTERVAL_MS
+  PUB_KIND_COUNT
+};
+
+// Writes the payload into buf and returns its length (<= 0 skips the publish)
+typedef int (*PublishBuilder)(char* buf, size_t len);
+
+struct PublishStats {
+  uint32_t published;
+  uint32_t coalesced;  // requests folded into an already pending publish
+  uint32_t failed;
+  uint32_t batches;    // corked writes
+};
+
+class PublishQueue {
+ public:
+  PublishQueue(PubSubClient& mqtt, CorkedClient& net, Outbox& outbox);
+
+  void define(PublishKind kind, const char* topic, bool retained, PublishBuilder build, bool store = false);
+  void request(PublishKind kind, uint32_t nowMs);
+  bool pending(PublishKind kind) const { return (pending_ & (1u << kind)) != 0; }
+  // Set by the connection manager; while offline nothing touches the client
+  void setOnline(bool online) { online_ = online; }
+
+  // Publishes every kind whose window has passed; kinds that fail, or
+  // whose corked write comes up short, stay pending. A short write also
+  // stops the client so the link reconnects. Returns the number published.
+  uint8_t flush(uint32_t nowMs);
+
+  // Publishes up to maxRecords stored records as one batch; returns the
+  // number sent. Stops at the first failure and keeps that record; records
+  // leave the outbox only once they were written out, and a short write
+  // stops the client as in flush().
+  uint8_t replay(uint8_t maxRecords);
+
+  const PublishStats& stats() const { return stats_; }
+
+ private:
+  void dropConnection();
+
+  struct Slot {
+    const char* topic;
+    bool retained;
+    bool store;
+    PublishBuilder build;
+    uint32_t requestedAt;
+  };
+
+  PubSubClient& mqtt_;
+  CorkedClient& net_;
+  Outbox& outbox_;
+  Slot slots_[PUB_KIND_COUNT];
+  uint8_t pending_;
+  bool online_;
+  PublishStats stats_;
+  char buf_[MQTT_PUBLISH_BUFFER];
+};
+
+extern PublishQueue publishQueue;
+
+#endif // PUBLISHQUEUE_H
@@ -0,0 +1,154 @@
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include "colorpipeline.h"
+#include "config.h"
+#include "ledstate.h"
+#include "ledstrip.h"
+#include "metrics.h"
+#include "renderer.h"
+
+static SemaphoreHandle_t frameMutex = nullptr;
+static StaticSemaphore_t frameMutexBuffer;
+static TaskHandle_t renderTaskHandle = nullptr;
+
+// Effect mailbox: handlers post under the frame lock, the task picks it up
+static EffectParams pendingEffect;
+static bool hasPendingEffect = false;
+static EffectParams currentEffect = {EFFECT_NONE, 0, 0, 0, 0, 0, 0};
+static uint32_t effectStartMs = 0;
+static uint8_t effectScratch[NUM_LEDS * 3];
+
+static uint8_t colorLUT[256];
+static int16_t appliedBrightness = -1;  // forces the first LUT build
+static bool appliedPower = false;
+
+FrameLock::FrameLock() {
+  if (frameMutex != nullptr) {
+    xSemaphoreTake(frameMutex, portMAX_DELAY);
+  }
+}
+
+FrameLock::~FrameLock() {
+  if (frameMutex != nullptr) {
+    xSemaphoreGive(frameMutex);
+  }
+}
+
+void initRenderer() {
+  if (frameMutex == nullptr) {
+    frameMutex = xSemaphoreCreateMutexStatic(&frameMutexBuffer);
+  }
+}
+
+void requestRender() {
+  if (renderTaskHandle != nullptr) {
+    xTaskNotifyGive(renderTaskHandle);
+  }
+}
+
+bool postEffect(const EffectParams& params) {
+  if (params.type != EFFECT_NONE && getEffect(params.type) == nullptr) {
+    return false;
+  }
+  {
+    FrameLock lock;
+    pendingEffect = params;
+    hasPendingEffect = true;
+  }
+  requestRender();
+  return true;
+}
+
+void cancelEffect() {
+  hasPendingEffect = false;
+  currentEffect.type = EFFECT_NONE;
+}
+
+uint8_t activeEffectType() {
+  FrameLock lock;
+  return hasPendingEffect ? pendingEffect.type : currentEffect.type;
+}
+
+// Runs the dirty span (or everything after a power/brightness change)
+// through the gamma+brightness LUT straight into the strip's GRB buffer.
+// The strip's own brightness stays at full scale. Called with the frame locked.
+static bool flushFrame() {
+  if (appliedBrightness != ledState.brightness) {
+    appliedBrightness = ledState.brightness;
+    buildColorLUT(colorLUT, (uint8_t)appliedBrightness);
+    frame.markAllDirty();
+  }
+  if (appliedPower != ledState.isOn) {
+    appliedPower = ledState.isOn;
+    frame.markAllDirty();
+  }
+  if (!frame.isDirty()) {
+    return false;
+  }
+
+  size_t offset = (size_t)frame.dirtyStart() * 3;
+  size_t count = frame.dirtyEnd() - frame.dirtyStart();
+  if (appliedPower) {
+    applyColorLUT(frame.data() + offset, strip.getPixels() + offset, count, colorLUT);
+  } else {
+    memset(strip.getPixels() + offset, 0, count * 3);
+  }
+  frame.clearDirty();
+  return true;
+}
+
+static void renderTask(void*) {
+  const TickType_t framePeriod = pdMS_TO_TICKS(1000 / RENDER_FPS) > 0 ? pdMS_TO_TICKS(1000 / RENDER_FPS) : 1;
+  TickType_t lastWake = xTaskGetTickCount();
+
+  for (;;) {
+    bool animating = false;
+    bool changed = false;
+    {
+      FrameLock lock;
+      if (hasPendingEffect) {
+        currentEffect = pendingEffect;
+        hasPendingEffect = false;
+        effectStartMs = millis();
+        const Effect* fx = getEffect(currentEffect.type);
+        if (fx != nullptr && fx->begin != nullptr) {
+          fx->begin(currentEffect, frame, effectScratch);
+        }
+      }
+
+      const Effect* fx = getEffect(currentEffect.type);
+      if (fx != nullptr) {
+        animating = fx->render(currentEffect, frame, effectScratch, millis() - effectStartMs);
+        if (!animating) {
+          currentEffect.type = EFFECT_NONE;
+        }
+      }
+      changed = flushFrame();
+    }
+
+    // The strip buffer is only touched by this task, so show() runs unlocked
+    if (changed) {
+      MetricTimer timer(stripShowTime);
+      strip.show();
+    }
+
+    if (animating) {
+      vTaskDelayUntil(&lastWake, framePeriod);
+    } else {
+      // Idle: sleep until a handler writes something
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      lastWake = xTaskGetTickCount();
+    }
+  }
+}
+
+void startRenderTask() {
+  initRenderer();
+  if (renderTaskHandle != nullptr) {
+    return;
+  }
+  xTaskCreatePinnedToCore(renderTask, "render", 4096, nullptr, RENDER_TASK_PRIORITY,
+                          &renderTaskHandle, RENDER_TASK_CORE);
+}
@@ -0,0 +1,35 @@
+#ifndef RENDERER_H
+#define RENDERER_H
+
+#include "effects.h"
+
+// The render task owns the LED strip. It runs the active effect at
+// RENDER_FPS and pushes changed pixels out; handlers only write the frame
+// or post effect parameters and never wait for the strip.
+
+void initRenderer();
+void startRenderTask();
+
+// Wakes the render task after the frame or ledState was changed
+void requestRender();
+
+// Starts an effect (replacing the current one). Returns false if the
+// effect type is unknown.
+bool postEffect(const EffectParams& params);
+
+// Stops the running effect; static writes to the frame call this first.
+// Must be called with the frame locked.
+void cancelEffect();
+
+uint8_t activeEffectType();
+
+// Scoped lock for the frame and ledState, shared with the render task
+class FrameLock {
+ public:
+  FrameLock();
+  ~FrameLock();
+  FrameLock(const FrameLock&) = delete;
+  FrameLock& operator=(const FrameLock&) = delete;
+};
+
+#endif // RENDERER_H
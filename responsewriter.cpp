@@ -0,0 +1,91 @@
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include "responsewriter.h"
+
+void ResponseWriter::begin(int code, const char* contentType) {
+  if (started_) {
+    return;
+  }
+  started_ = true;
+  server_.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server_.send(code, contentType, "");
+}
+
+void ResponseWriter::flush() {
+  if (used_ > 0) {
+    server_.sendContent(buf_, used_);
+    used_ = 0;
+  }
+}
+
+void ResponseWriter::write(const char* data, size_t len) {
+  while (len > 0) {
+    if (used_ == BUFFER_SIZE) {
+      flush();
+    }
+    size_t n = BUFFER_SIZE - used_;
+    if (n > len) {
+      n = len;
+    }
+    memcpy(buf_ + used_, data, n);
+    used_ += n;
+    data += n;
+    len -= n;
+  }
+}
+
+void ResponseWriter::print(const char* s) {
+  write(s, strlen(s));
+}
+
+void ResponseWriter::printf(const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(buf_ + used_, BUFFER_SIZE - used_, fmt, args);
+  va_end(args);
+  if (n < 0) {
+    return;
+  }
+  if ((size_t)n < BUFFER_SIZE - used_) {
+    used_ += n;
+    return;
+  }
+
+  // Did not fit behind what is already buffered: flush and format again
+  flush();
+  va_start(args, fmt);
+  n = vsnprintf(buf_, BUFFER_SIZE, fmt, args);
+  va_end(args);
+  used_ = (size_t)n < BUFFER_SIZE ? n : BUFFER_SIZE - 1;
+}
+
+void ResponseWriter::printJsonString(const char* s) {
+  print('"');
+  const char* run = s;
+  for (; *s != '\0'; s++) {
+    uint8_t c = (uint8_t)*s;
+    if (c != '"' && c != '\\' && c >= 0x20) {
+      continue;
+    }
+    write(run, s - run);
+    run = s + 1;
+    if (c == '"' || c == '\\') {
+      print('\\');
+      print((char)c);
+    } else {
+      printf("\\u%04x", c);
+    }
+  }
+  write(run, s - run);
+  print('"');
+}
+
+void ResponseWriter::end() {
+  if (!started_ || ended_) {
+    return;
+  }
+  ended_ = true;
+  flush();
+  server_.sendContent("", 0);
+}
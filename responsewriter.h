@@ -0,0 +1,52 @@
+#ifndef RESPONSEWRITER_H
+#define RESPONSEWRITER_H
+
+#include <stdarg.h>
+#include <stddef.h>
+#include "httpserver.h"
+
+// Streams a response body out of an HttpServer handler with chunked
+// transfer encoding. Fragments are collected in a small buffer that lives
+// inside the writer (on the handler's stack) and sent as one chunk when it
+// fills, so heap use stays flat. The whole body is written before the
+// handler returns, so it has to fit what the server can hold back for a
+// slow client; bodies that grow with the data use HttpServer::sendStream().
+//
+//   ResponseWriter out(server);
+//   out.begin(200, "application/json");
+//   out.printf("{\"count\":%d,\"items\":[", n);
+//   ...
+//   out.end();
+
+class ResponseWriter {
+ public:
+  static const size_t BUFFER_SIZE = 256;
+
+  explicit ResponseWriter(HttpServer& server) : server_(server), used_(0), started_(false), ended_(false) {}
+  ~ResponseWriter() { end(); }
+
+  // Sends the status line and headers queued with server.sendHeader()
+  void begin(int code, const char* contentType);
+
+  void write(const char* data, size_t len);
+  void print(const char* s);
+  void print(char c) { write(&c, 1); }
+  // A single formatted fragment is truncated at BUFFER_SIZE - 1 bytes
+  void printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+  // Writes s as a quoted JSON string, escaping as needed
+  void printJsonString(const char* s);
+
+  // Flushes the last chunk and the terminating zero-length chunk
+  void end();
+
+ private:
+  void flush();
+
+  HttpServer& server_;
+  char buf_[BUFFER_SIZE];
+  size_t used_;
+  bool started_;
+  bool ended_;
+};
+
+#endif // RESPONSEWRITER_H
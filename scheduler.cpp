@@ -0,0 +1,189 @@
+#include <Arduino.h>
+#include "log.h"
+#include "scheduler.h"
+
+static_assert(SCHEDULER_MAX_TIMERS < 0xFE, "timer ids must stay below the slot markers");
+static_assert(SCHEDULER_WHEEL_SLOTS < 0xFE, "wheel slots must stay below the slot markers");
+
+Scheduler scheduler;
+LoopStats loopStats = {0, 0, 0, 0, 0};
+
+Scheduler::Scheduler() : freeList_(0), active_(0), tick_(0), lastMs_(0), started_(false) {
+  for (uint8_t i = 0; i < SCHEDULER_MAX_TIMERS; i++) {
+    timers_[i].cb = nullptr;
+    timers_[i].slot = NIL;
+    timers_[i].generation = 0;
+    timers_[i].next = i + 1 < SCHEDULER_MAX_TIMERS ? i + 1 : NIL;
+  }
+  for (uint8_t i = 0; i < SCHEDULER_WHEEL_SLOTS; i++) {
+    wheel_[i] = NIL;
+  }
+}
+
+int Scheduler::indexOf(TimerHandle handle) const {
+  if (handle == INVALID_TIMER) {
+    return -1;
+  }
+  uint8_t id = (handle & 0xFF) - 1;
+  if (id >= SCHEDULER_MAX_TIMERS || timers_[id].slot == NIL || timers_[id].generation != (handle >> 8)) {
+    return -1;
+  }
+  return id;
+}
+
+TimerHandle Scheduler::schedule(uint32_t delayMs, TimerCallback cb, void* arg, uint32_t periodMs) {
+  if (cb == nullptr || freeList_ == NIL) {
+    LOG_E("SCHED", "✗ Out of timers (%d)", SCHEDULER_MAX_TIMERS);
+    return INVALID_TIMER;
+  }
+  if (!started_) {
+    lastMs_ = millis();
+    started_ = true;
+  }
+
+  uint8_t id = freeList_;
+  Timer& t = timers_[id];
+  freeList_ = t.next;
+  t.cb = cb;
+  t.arg = arg;
+  t.periodTicks = periodMs > 0 ? toTicks(periodMs) : 0;
+  t.generation++;
+  if (t.generation == 0) {
+    t.generation = 1;
+  }
+  insert(id, toTicks(delayMs));
+  active_++;
+  return (TimerHandle)((t.generation << 8) | (id + 1));
+}
+
+bool Scheduler::cancel(TimerHandle handle) {
+  int id = indexOf(handle);
+  if (id < 0) {
+    return false;
+  }
+  if (timers_[id].slot == IN_DUE_LIST) {
+    // Being fired right now; run() frees it when it gets there
+    timers_[id].cb = nullptr;
+    timers_[id].periodTicks = 0;
+    return true;
+  }
+  unlink(id);
+  release(id);
+  return true;
+}
+
+bool Scheduler::pending(TimerHandle handle) const {
+  int id = indexOf(handle);
+  return id >= 0 && timers_[id].cb != nullptr;
+}
+
+// ticks >= 1: the timer fires when tick_ reaches tick_ + ticks
+void Scheduler::insert(uint8_t id, uint32_t ticks) {
+  Timer& t = timers_[id];
+  uint8_t slot = (tick_ + ticks) % SCHEDULER_WHEEL_SLOTS;
+  uint32_t rounds = (ticks - 1) / SCHEDULER_WHEEL_SLOTS;
+  t.rounds = rounds > 0xFFFF ? 0xFFFF : rounds;
+  t.slot = slot;
+  t.prev = NIL;
+  t.next = wheel_[slot];
+  if (t.next != NIL) {
+    timers_[t.next].prev = id;
+  }
+  wheel_[slot] = id;
+}
+
+void Scheduler::unlink(uint8_t id) {
+  Timer& t = timers_[id];
+  if (t.prev != NIL) {
+    timers_[t.prev].next = t.next;
+  } else {
+    wheel_[t.slot] = t.next;
+  }
+  if (t.next != NIL) {
+    timers_[t.next].prev = t.prev;
+  }
+}
+
+void Scheduler::release(uint8_t id) {
+  Timer& t = timers_[id];
+  t.cb = nullptr;
+  t.slot = NIL;
+  t.next = freeList_;
+  freeList_ = id;
+  active_--;
+}
+
+void Scheduler::advance() {
+  tick_++;
+  uint8_t slot = tick_ % SCHEDULER_WHEEL_SLOTS;
+
+  // Pull due timers off the slot first, so callbacks can freely schedule
+  // and cancel while the due list is walked
+  uint8_t due = NIL;
+  uint8_t id = wheel_[slot];
+  while (id != NIL) {
+    uint8_t next = timers_[id].next;
+    if (timers_[id].rounds > 0) {
+      timers_[id].rounds--;
+    } else {
+      unlink(id);
+      timers_[id].slot = IN_DUE_LIST;
+      timers_[id].next = due;
+      due = id;
+    }
+    id = next;
+  }
+
+  while (due != NIL) {
+    id = due;
+    Timer& t = timers_[id];
+    due = t.next;
+    TimerCallback cb = t.cb;
+    void* arg = t.arg;
+    if (cb != nullptr && t.periodTicks > 0) {
+      insert(id, t.periodTicks);
+    } else {
+      release(id);
+    }
+    if (cb != nullptr) {
+      cb(arg);
+    }
+  }
+}
+
+void Scheduler::run(uint32_t nowMs) {
+  if (!started_) {
+    lastMs_ = nowMs;
+    started_ = true;
+    return;
+  }
+  while (nowMs - lastMs_ >= SCHEDULER_TICK_MS) {
+    lastMs_ += SCHEDULER_TICK_MS;
+    advance();
+  }
+}
+
+void recordLoopTime(uint32_t us) {
+  loopStats.iterations++;
+  loopStats.totalUs += us;
+  if (us > loopStats.maxUs) {
+    loopStats.maxUs = us;
+  }
+  if (us > LOOP_BUDGET_US) {
+    loopStats.overruns++;
+  }
+}
+
+void reportLoopStats() {
+  if (loopStats.iterations == 0) {
+    return;
+  }
+  LOG_I("LOOP", "%lu iterations, avg %lu us, max %lu us, %lu over %d us budget",
+        (unsigned long)loopStats.iterations, (unsigned long)(loopStats.totalUs / loopStats.iterations),
+        (unsigned long)loopStats.maxUs, (unsigned long)loopStats.overruns, LOOP_BUDGET_US);
+  loopStats.lastMaxUs = loopStats.maxUs;
+  loopStats.iterations = 0;
+  loopStats.totalUs = 0;
+  loopStats.maxUs = 0;
+  loopStats.overruns = 0;
+}
@@ -0,0 +1,83 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+
+// Cooperative timer wheel driven from loop(). Timed actions (buzzer off,
+// reconnect checks, reboot) are scheduled callbacks instead of delay(), so
+// loop() never sleeps. Timers come from a fixed pool; scheduling and
+// cancelling are O(1) and nothing is allocated. Callbacks run on the
+// loop() task and must not block.
+
+typedef void (*TimerCallback)(void* arg);
+typedef uint16_t TimerHandle;  // 0 = invalid
+
+const TimerHandle INVALID_TIMER = 0;
+
+class Scheduler {
+ public:
+  static const uint8_t NIL = 0xFF;
+
+  Scheduler();
+
+  // Runs cb once after delayMs, then every periodMs if periodMs > 0
+  TimerHandle schedule(uint32_t delayMs, TimerCallback cb, void* arg = nullptr, uint32_t periodMs = 0);
+  TimerHandle every(uint32_t periodMs, TimerCallback cb, void* arg = nullptr) { return schedule(periodMs, cb, arg, periodMs); }
+  // Safe on stale handles and from inside callbacks
+  bool cancel(TimerHandle handle);
+  bool pending(TimerHandle handle) const;
+
+  // Advances the wheel to nowMs and fires everything that came due
+  void run(uint32_t nowMs);
+
+  uint8_t activeTimers() const { return active_; }
+
+ private:
+  static const uint8_t IN_DUE_LIST = 0xFE;
+
+  struct Timer {
+    TimerCallback cb;
+    void* arg;
+    uint32_t periodTicks;
+    uint16_t rounds;
+    uint8_t slot;  // wheel slot, IN_DUE_LIST, or NIL when free
+    uint8_t generation;
+    uint8_t prev, next;
+  };
+
+  void insert(uint8_t id, uint32_t ticks);
+  void unlink(uint8_t id);
+  void release(uint8_t id);
+  void advance();
+  static uint32_t toTicks(uint32_t ms) { return ms == 0 ? 1 : (ms + SCHEDULER_TICK_MS - 1) / SCHEDULER_TICK_MS; }
+  int indexOf(TimerHandle handle) const;
+
+  Timer timers_[SCHEDULER_MAX_TIMERS];
+  uint8_t wheel_[SCHEDULER_WHEEL_SLOTS];
+  uint8_t freeList_;
+  uint8_t active_;
+  uint32_t tick_;
+  uint32_t lastMs_;
+  bool started_;
+};
+
+extern Scheduler scheduler;
+
+// Per-iteration loop() timing, reported periodically and in the MQTT status
+struct LoopStats {
+  uint32_t iterations;
+  uint32_t totalUs;
+  uint32_t maxUs;
+  uint32_t overruns;    // iterations longer than LOOP_BUDGET_US
+  uint32_t lastMaxUs;   // maxUs of the last completed report window
+};
+
+extern LoopStats loopStats;
+
+void recordLoopTime(uint32_t us);
+// Logs the current window and starts a new one
+void reportLoopStats();
+
+#endif // SCHEDULER_H
@@ -0,0 +1,177 @@
+#include <Arduino.h>
+#include <string.h>
+#include "sessionstore.h"
+
+SessionStore sessions;
+
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
+static int hexValue(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+// Compares every byte so the time taken does not leak the match length
+static bool tokenEquals(const uint8_t* a, const uint8_t* b) {
+  uint8_t diff = 0;
+  for (size_t i = 0; i < SESSION_TOKEN_BYTES; i++) {
+    diff |= a[i] ^ b[i];
+  }
+  return diff == 0;
+}
+
+SessionStore::SessionStore() : count_(0), stats_{0, 0} {
+  memset(slots_, 0, sizeof(slots_));
+}
+
+size_t SessionStore::home(const uint8_t* token) {
+  uint32_t h = (uint32_t)token[0] | ((uint32_t)token[1] << 8) | ((uint32_t)token[2] << 16) | ((uint32_t)token[3] << 24);
+  return h & (SESSION_CAPACITY - 1);
+}
+
+Session* SessionStore::create(const char* username, UserRole role, unsigned long now, char* tokenHex) {
+  if (count_ >= MAX_SESSIONS) {
+    makeRoom(now);
+  }
+
+  uint8_t token[SESSION_TOKEN_BYTES];
+  size_t slot;
+  do {
+    for (size_t i = 0; i < SESSION_TOKEN_BYTES; i += 4) {
+      uint32_t r = esp_random();
+      memcpy(token + i, &r, 4);
+    }
+  } while (find(token, now) != nullptr);
+
+  slot = home(token);
+  while (slots_[slot].used) {
+    slot = (slot + 1) & (SESSION_CAPACITY - 1);
+  }
+
+  Session& s = slots_[slot];
+  memcpy(s.token, token, SESSION_TOKEN_BYTES);
+  strncpy(s.username, username, SESSION_USERNAME_MAX - 1);
+  s.username[SESSION_USERNAME_MAX - 1] = '\0';
+  s.role = role;
+  s.loginTime = now;
+  s.used = true;
+  count_++;
+
+  for (size_t i = 0; i < SESSION_TOKEN_BYTES; i++) {
+    tokenHex[i * 2] = HEX_DIGITS[token[i] >> 4];
+    tokenHex[i * 2 + 1] = HEX_DIGITS[token[i] & 0x0F];
+  }
+  tokenHex[SESSION_TOKEN_HEX_LEN] = '\0';
+  return &s;
+}
+
+size_t SessionStore::slotOf(const uint8_t* token) const {
+  size_t slot = home(token);
+  for (size_t probes = 0; probes < SESSION_CAPACITY && slots_[slot].used; probes++) {
+    if (tokenEquals(slots_[slot].token, token)) {
+      return slot;
+    }
+    slot = (slot + 1) & (SESSION_CAPACITY - 1);
+  }
+  return SESSION_CAPACITY;
+}
+
+Session* SessionStore::find(const uint8_t* token, unsigned long now) {
+  size_t slot = slotOf(token);
+  if (slot == SESSION_CAPACITY) {
+    return nullptr;
+  }
+  if (expired(slots_[slot], now)) {
+    eraseSlot(slot);
+    return nullptr;
+  }
+  return &slots_[slot];
+}
+
+bool SessionStore::contains(const uint8_t* token, unsigned long now) const {
+  size_t slot = slotOf(token);
+  return slot != SESSION_CAPACITY && !expired(slots_[slot], now);
+}
+
+// Only cookie lookups count towards the stats; create() probes with find()
+Session* SessionStore::findHex(const char* hex, size_t len, unsigned long now) {
+  stats_.lookups++;
+  if (len != SESSION_TOKEN_HEX_LEN) {
+    stats_.misses++;
+    return nullptr;
+  }
+  uint8_t token[SESSION_TOKEN_BYTES];
+  for (size_t i = 0; i < SESSION_TOKEN_BYTES; i++) {
+    int hi = hexValue(hex[i * 2]);
+    int lo = hexValue(hex[i * 2 + 1]);
+    if (hi < 0 || lo < 0) {
+      stats_.misses++;
+      return nullptr;
+    }
+    token[i] = (uint8_t)((hi << 4) | lo);
+  }
+  Session* s = find(token, now);
+  if (s == nullptr) {
+    stats_.misses++;
+  }
+  return s;
+}
+
+void SessionStore::remove(Session* session) {
+  if (session == nullptr || session < slots_ || session >= slots_ + SESSION_CAPACITY || !session->used) {
+    return;
+  }
+  eraseSlot(session - slots_);
+}
+
+// Backward-shift deletion: pull later members of the probe chain into the
+// hole so lookups never need tombstones
+void SessionStore::eraseSlot(size_t slot) {
+  size_t hole = slot;
+  size_t next = (slot + 1) & (SESSION_CAPACITY - 1);
+  while (slots_[next].used) {
+    size_t want = home(slots_[next].token);
+    // Move next into the hole unless its home lies cyclically in (hole, next]
+    bool stays = hole <= next ? (want > hole && want <= next) : (want > hole || want <= next);
+    if (!stays) {
+      slots_[hole] = slots_[next];
+      hole = next;
+    }
+    next = (next + 1) & (SESSION_CAPACITY - 1);
+  }
+  memset(&slots_[hole], 0, sizeof(Session));
+  count_--;
+}
+
+// Only runs when the table is full: drop expired sessions, and if that
+// frees nothing, the oldest one
+void SessionStore::makeRoom(unsigned long now) {
+  for (size_t i = 0; i < SESSION_CAPACITY; ) {
+    if (slots_[i].used && expired(slots_[i], now)) {
+      eraseSlot(i);  // may shift another entry into slot i
+    } else {
+      i++;
+    }
+  }
+  if (count_ < MAX_SESSIONS) {
+    return;
+  }
+
+  size_t oldest = SESSION_CAPACITY;
+  for (size_t i = 0; i < SESSION_CAPACITY; i++) {
+    if (slots_[i].used && (oldest == SESSION_CAPACITY || now - slots_[i].loginTime > now - slots_[oldest].loginTime)) {
+      oldest = i;
+    }
+  }
+  if (oldest < SESSION_CAPACITY) {
+    eraseSlot(oldest);
+  }
+}
@@ -0,0 +1,69 @@
+#ifndef SESSIONSTORE_H
+#define SESSIONSTORE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+#include "user_roles.h"
+
+// Fixed-capacity session table, open addressed on the binary token.
+// Tokens are random, so the first bytes are used directly as the hash.
+// Lookups are O(1) on average, never allocate, and expire sessions lazily
+// when they are touched; there is no periodic cleanup pass.
+
+static_assert((SESSION_CAPACITY & (SESSION_CAPACITY - 1)) == 0, "SESSION_CAPACITY must be a power of two");
+
+const size_t SESSION_TOKEN_BYTES = 16;
+const size_t SESSION_TOKEN_HEX_LEN = SESSION_TOKEN_BYTES * 2;
+const size_t SESSION_USERNAME_MAX = 24;
+
+struct Session {
+  uint8_t token[SESSION_TOKEN_BYTES];
+  char username[SESSION_USERNAME_MAX];
+  UserRole role;
+  unsigned long loginTime;
+  bool used;
+};
+
+struct SessionStats {
+  uint32_t lookups;
+  uint32_t misses;  // no live session for the token
+};
+
+class SessionStore {
+ public:
+  // Probe chains stay short by never filling more than 3/4 of the table
+  static const size_t MAX_SESSIONS = SESSION_CAPACITY * 3 / 4;
+
+  SessionStore();
+
+  // Creates a session and writes its token as hex (SESSION_TOKEN_HEX_LEN
+  // chars + NUL) into tokenHex. Evicts the oldest session when full.
+  Session* create(const char* username, UserRole role, unsigned long now, char* tokenHex);
+
+  // Returned pointers are valid until the next create/find/remove call
+  Session* find(const uint8_t* token, unsigned long now);
+  Session* findHex(const char* hex, size_t len, unsigned long now);
+  // Like find() but leaves expired sessions in place, so pointers from an
+  // earlier find() stay valid
+  bool contains(const uint8_t* token, unsigned long now) const;
+  void remove(Session* session);
+
+  size_t count() const { return count_; }
+  const SessionStats& stats() const { return stats_; }
+
+ private:
+  static size_t home(const uint8_t* token);
+  size_t slotOf(const uint8_t* token) const;  // SESSION_CAPACITY if absent
+  void eraseSlot(size_t slot);
+  bool expired(const Session& s, unsigned long now) const { return now - s.loginTime > SESSION_TIMEOUT_MS; }
+  void makeRoom(unsigned long now);
+
+  Session slots_[SESSION_CAPACITY];
+  size_t count_;
+  SessionStats stats_;
+};
+
+extern SessionStore sessions;
+
+#endif // SESSIONSTORE_H
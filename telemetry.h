@@ -0,0 +1,253 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "config.h"
+
+// Schema and encoders for the messages published on the status topic.
+// Each message is described once below as FIELD(id, name, type, member);
+// the struct and both encodings are generated from that list.
+//
+//   JSON: {"state":"on","color":"red",...}       - field names as keys
+//   CBOR: {0: kind, 1: "on", 2: "red", ...}      - field ids as keys
+//
+// CBOR (RFC 8949) drops the repeated key names and encodes small numbers
+// in one byte. Key 0 holds the message kind so consumers can tell the
+// messages on the shared topic apart. Selected with TELEMETRY_FORMAT.
+
+#define TELEMETRY_JSON 0
+#define TELEMETRY_CBOR 1
+
+#ifndef TELEMETRY_FORMAT
+#define TELEMETRY_FORMAT TELEMETRY_JSON
+#endif
+
+enum TelemetryKind : uint8_t {
+  TELEMETRY_LED_STATUS = 1,
+  TELEMETRY_DEVICE_STATUS = 2,
+  TELEMETRY_DATA = 3
+};
+
+#define LED_STATUS_SCHEMA(FIELD)         \
+  FIELD(1, "state", TEXT, state)         \
+  FIELD(2, "color", TEXT, color)         \
+  FIELD(3, "timestamp", TEXT, timestamp) \
+  FIELD(4, "device", TEXT, device)       \
+  FIELD(5, "late_ms", INT, lateMs)
+
+#define DEVICE_STATUS_SCHEMA(FIELD)               \
+  FIELD(1, "device", TEXT, device)                \
+  FIELD(2, "ip", TEXT, ip)                        \
+  FIELD(3, "rssi", INT, rssi)                     \
+  FIELD(4, "uptime", UINT, uptime)                \
+  FIELD(5, "free_heap", UINT, freeHeap)           \
+  FIELD(6, "reconnects", UINT, reconnects)        \
+  FIELD(7, "loop_max_us", UINT, loopMaxUs)        \
+  FIELD(8, "mqtt_connects", UINT, mqttConnects)   \
+  FIELD(9, "mqtt_failures", UINT, mqttFailures)   \
+  FIELD(10, "connect_ms", UINT, connectMs)        \
+  FIELD(11, "max_connect_ms", UINT, maxConnectMs) \
+  FIELD(12, "outage_ms", UINT, outageMs)
+
+#define TELEMETRY_DATA_SCHEMA(FIELD) \
+  FIELD(1, "device", TEXT, device)   \
+  FIELD(2, "count", UINT, count)     \
+  FIELD(3, "uptime", UINT, uptime)   \
+  FIELD(4, "rssi", INT, rssi)        \
+  FIELD(5, "button", UINT, button)   \
+  FIELD(6, "led", TEXT, led)         \
+  FIELD(7, "r", UINT, r)             \
+  FIELD(8, "g", UINT, g)             \
+  FIELD(9, "b", UINT, b)
+
+#define TELEMETRY_TYPE_TEXT const char*
+#define TELEMETRY_TYPE_UINT uint32_t
+#define TELEMETRY_TYPE_INT int32_t
+
+#define TELEMETRY_MEMBER(id, name, type, member) TELEMETRY_TYPE_##type member;
+#define TELEMETRY_COUNT(id, name, type, member) +1
+#define TELEMETRY_ENCODE(id, name, type, member) w.field(id, name, m.member);
+
+#define TELEMETRY_MESSAGE(Struct, kind, SCHEMA)                  \
+  struct Struct {                                                \
+    SCHEMA(TELEMETRY_MEMBER)                                     \
+  };                                                             \
+  template <typename Writer>                                     \
+  inline int encode(Writer& w, const Struct& m) {                \
+    w.begin(kind, 0 SCHEMA(TELEMETRY_COUNT));                    \
+    SCHEMA(TELEMETRY_ENCODE)                                     \
+    return w.end();                                              \
+  }
+
+TELEMETRY_MESSAGE(LEDStatusMsg, TELEMETRY_LED_STATUS, LED_STATUS_SCHEMA)
+TELEMETRY_MESSAGE(DeviceStatusMsg, TELEMETRY_DEVICE_STATUS, DEVICE_STATUS_SCHEMA)
+TELEMETRY_MESSAGE(TelemetryDataMsg, TELEMETRY_DATA, TELEMETRY_DATA_SCHEMA)
+
+// Both writers return the full encoded length from end(), like snprintf:
+// a result >= the buffer size means the output was cut short.
+class JsonWriter {
+ public:
+  JsonWriter(char* buf, size_t len) : buf_(buf), cap_(len), room_(len > 0 ? len - 1 : 0), len_(0), first_(true) {}
+
+  void begin(uint8_t, uint8_t) {
+    put('{');
+  }
+
+  void field(uint8_t, const char* name, const char* value) {
+    key(name);
+    put('"');
+    for (const char* c = value; *c != '\0'; c++) {
+      if (*c == '"' || *c == '\\') {
+        put('\\');
+      }
+      put(*c);
+    }
+    put('"');
+  }
+
+  void field(uint8_t, const char* name, uint32_t value) {
+    key(name);
+    number(value, false);
+  }
+
+  void field(uint8_t, const char* name, int32_t value) {
+    key(name);
+    number(value < 0 ? 0u - (uint32_t)value : (uint32_t)value, value < 0);
+  }
+
+  int end() {
+    put('}');
+    if (cap_ > 0) {
+      buf_[len_ < room_ ? len_ : room_] = '\0';
+    }
+    return (int)len_;
+  }
+
+ private:
+  void put(char c) {
+    if (len_ < room_) {
+      buf_[len_] = c;
+    }
+    len_++;
+  }
+
+  void key(const char* name) {
+    if (!first_) {
+      put(',');
+    }
+    first_ = false;
+    put('"');
+    while (*name != '\0') {
+      put(*name++);
+    }
+    put('"');
+    put(':');
+  }
+
+  void number(uint32_t v, bool negative) {
+    char digits[10];
+    uint8_t n = 0;
+    do {
+      digits[n++] = '0' + v % 10;
+      v /= 10;
+    } while (v != 0);
+    if (negative) {
+      put('-');
+    }
+    while (n > 0) {
+      put(digits[--n]);
+    }
+  }
+
+  char* buf_;
+  size_t cap_;
+  size_t room_;  // characters that fit before the NUL
+  size_t len_;
+  bool first_;
+};
+
+class CborWriter {
+ public:
+  CborWriter(char* buf, size_t len) : buf_((uint8_t*)buf), cap_(len), len_(0) {}
+
+  void begin(uint8_t kind, uint8_t fields) {
+    head(5, fields + 1);  // map
+    head(0, 0);
+    head(0, kind);
+  }
+
+  void field(uint8_t id, const char*, const char* value) {
+    size_t n = strlen(value);
+    head(0, id);
+    head(3, n);  // text string
+    for (size_t i = 0; i < n; i++) {
+      put(value[i]);
+    }
+  }
+
+  void field(uint8_t id, const char*, uint32_t value) {
+    head(0, id);
+    head(0, value);
+  }
+
+  void field(uint8_t id, const char*, int32_t value) {
+    head(0, id);
+    if (value < 0) {
+      head(1, (uint32_t)(-(value + 1)));
+    } else {
+      head(0, (uint32_t)value);
+    }
+  }
+
+  int end() { return (int)len_; }
+
+ private:
+  void put(uint8_t b) {
+    if (len_ < cap_) {
+      buf_[len_] = b;
+    }
+    len_++;
+  }
+
+  // Major type plus the shortest argument encoding
+  void head(uint8_t major, uint32_t v) {
+    uint8_t m = major << 5;
+    if (v < 24) {
+      put(m | v);
+    } else if (v <= 0xFF) {
+      put(m | 24);
+      put(v);
+    } else if (v <= 0xFFFF) {
+      put(m | 25);
+      put(v >> 8);
+      put(v);
+    } else {
+      put(m | 26);
+      put(v >> 24);
+      put(v >> 16);
+      put(v >> 8);
+      put(v);
+    }
+  }
+
+  uint8_t* buf_;
+  size_t cap_;
+  size_t len_;
+};
+
+#if TELEMETRY_FORMAT == TELEMETRY_CBOR
+typedef CborWriter TelemetryWriter;
+#else
+typedef JsonWriter TelemetryWriter;
+#endif
+
+// Encodes in the configured format; same contract as the writers' end()
+template <typename Msg>
+inline int encodeTelemetry(const Msg& msg, char* buf, size_t len) {
+  TelemetryWriter w(buf, len);
+  return encode(w, msg);
+}
+
+#endif // TELEMETRY_H
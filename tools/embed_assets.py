@@ -0,0 +1,72 @@
+"""
+Compress the pages in web/ and embed them as PROGMEM arrays in webassets.h.
+
+Runs automatically before every PlatformIO build (extra_scripts = pre:...),
+or by hand:  python3 tools/embed_assets.py
+"""
+import gzip
+import hashlib
+import os
+
+ASSETS = [
+    # (source file, C identifier prefix)
+    ("login.html", "LOGIN_HTML"),
+    ("dashboard.html", "DASHBOARD_HTML"),
+]
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    ROOT = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB_DIR = os.path.join(ROOT, "web")
+OUT_FILE = os.path.join(ROOT, "webassets.h")
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def render():
+    out = [
+        "// Generated by tools/embed_assets.py from web/ - do not edit by hand",
+        "#ifndef WEBASSETS_H",
+        "#define WEBASSETS_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+    ]
+    for name, ident in ASSETS:
+        with open(os.path.join(WEB_DIR, name), "rb") as f:
+            raw = f.read()
+        # mtime=0 keeps the output (and therefore the ETag) reproducible
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = hashlib.sha1(gz).hexdigest()[:16]
+        out.append("// web/%s: %d bytes, %d gzipped" % (name, len(raw), len(gz)))
+        out.append('#define %s_ETAG "\\"%s\\""' % (ident, etag))
+        out.append("const size_t %s_GZ_LEN = %d;" % (ident, len(gz)))
+        out.append("const uint8_t %s_GZ[] PROGMEM = {" % ident)
+        out.append(c_array(gz))
+        out.append("};")
+        out.append("")
+    out.append("#endif // WEBASSETS_H")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    content = render()
+    try:
+        with open(OUT_FILE, "r") as f:
+            if f.read() == content:
+                return
+    except IOError:
+        pass
+    with open(OUT_FILE, "w") as f:
+        f.write(content)
+    print("embed_assets: regenerated %s" % os.path.relpath(OUT_FILE, ROOT))
+
+
+main()
@@ -0,0 +1,316 @@
+"""
+Check that a group LED command lands on every board at the same time.
+
+Publishes colour commands carrying {"at": epoch ms} to a group topic and
+collects the LED status each board reports afterwards. The status carries
+"late_ms", how far after the target the board actually applied it, so the
+spread across boards shows how well the group stays in step.
+
+Needs only the standard library. Against a local mosquitto:
+
+    mosquitto -p 1883 &
+    python3 tools/fleet_sync_check.py --sim 20
+
+--serve starts a minimal built-in broker instead (QoS 0 only), for hosts
+without mosquitto. --sim N adds N simulated boards that follow the same
+rules as the firmware (hold the command until "at", then report), with
+--jitter-ms of random delivery delay each to stand in for broker fan-out.
+Real boards in the group are counted too; pass --devices with the total
+to expect.
+"""
+import argparse
+import json
+import random
+import socket
+import socketserver
+import struct
+import sys
+import threading
+import time
+
+STATUS_TOPIC = "home/led/status"
+TOPIC_PREFIX = "home/led"
+
+
+def now_ms():
+    return int(time.time() * 1000)
+
+
+# ========================================
+# MQTT 3.1.1 framing (QoS 0 only)
+# ========================================
+def encode_length(n):
+    out = bytearray()
+    while True:
+        b = n % 128
+        n //= 128
+        out.append(b | 0x80 if n else b)
+        if not n:
+            return bytes(out)
+
+
+def encode_string(s):
+    data = s.encode() if isinstance(s, str) else s
+    return struct.pack("!H", len(data)) + data
+
+
+def packet(kind, body):
+    return bytes([kind]) + encode_length(len(body)) + body
+
+
+def read_exact(sock, n):
+    buf = b""
+    while len(buf) < n:
+        chunk = sock.recv(n - len(buf))
+        if not chunk:
+            raise ConnectionError("closed")
+        buf += chunk
+    return buf
+
+
+def read_packet(sock):
+    header = read_exact(sock, 1)[0]
+    length, shift = 0, 0
+    while True:
+        b = read_exact(sock, 1)[0]
+        length |= (b & 0x7F) << shift
+        shift += 7
+        if not b & 0x80:
+            break
+    return header, read_exact(sock, length) if length else b""
+
+
+def parse_publish(header, body):
+    n = struct.unpack("!H", body[:2])[0]
+    topic = body[2:2 + n].decode()
+    rest = body[2 + n:]
+    if (header >> 1) & 3:
+        rest = rest[2:]  # packet id
+    return topic, rest
+
+
+def topic_matches(pattern, topic):
+    p, t = pattern.split("/"), topic.split("/")
+    for i, level in enumerate(p):
+        if level == "#":
+            return True
+        if i >= len(t) or (level != "+" and level != t[i]):
+            return False
+    return len(p) == len(t)
+
+
+class MqttClient:
+    def __init__(self, host, port, client_id, on_message):
+        self.sock = socket.create_connection((host, port))
+        self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self.lock = threading.Lock()
+        self.on_message = on_message
+        body = encode_string("MQTT") + bytes([4, 0x02]) + struct.pack("!H", 60) + encode_string(client_id)
+        self.sock.sendall(packet(0x10, body))
+        header, ack = read_packet(self.sock)
+        if header >> 4 != 2 or ack[1] != 0:
+            raise ConnectionError("connect refused")
+        threading.Thread(target=self._reader, daemon=True).start()
+
+    def subscribe(self, *topics):
+        body = struct.pack("!H", 1) + b"".join(encode_string(t) + b"\x00" for t in topics)
+        with self.lock:
+            self.sock.sendall(packet(0x82, body))
+
+    def publish(self, topic, payload, retain=False):
+        data = payload.encode() if isinstance(payload, str) else payload
+        with self.lock:
+            self.sock.sendall(packet(0x30 | (1 if retain else 0), encode_string(topic) + data))
+
+    def close(self):
+        try:
+            self.sock.sendall(packet(0xE0, b""))
+            self.sock.close()
+        except OSError:
+            pass
+
+    def _reader(self):
+        try:
+            while True:
+                header, body = read_packet(self.sock)
+                if header >> 4 == 3:
+                    self.on_message(*parse_publish(header, body))
+        except (ConnectionError, OSError):
+            pass
+
+
+# ========================================
+# Built-in broker (--serve)
+# ========================================
+class Broker(socketserver.ThreadingTCPServer):
+    daemon_threads = True
+    allow_reuse_address = True
+
+    def __init__(self, port):
+        super().__init__(("127.0.0.1", port), BrokerSession)
+        self.lock = threading.Lock()
+        self.sessions = set()
+        self.retained = {}
+
+    def route(self, topic, payload, retain):
+        with self.lock:
+            if retain:
+                self.retained[topic] = payload
+            targets = [s for s in self.sessions if any(topic_matches(f, topic) for f in s.filters)]
+        for s in targets:
+            s.send(packet(0x30, encode_string(topic) + payload))
+
+
+class BrokerSession(socketserver.BaseRequestHandler):
+    def handle(self):
+        self.filters = []
+        self.send_lock = threading.Lock()
+        self.request.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        broker = self.server
+        try:
+            read_packet(self.request)
+            self.send(packet(0x20, b"\x00\x00"))
+            with broker.lock:
+                broker.sessions.add(self)
+            while True:
+                header, body = read_packet(self.request)
+                kind = header >> 4
+                if kind == 3:
+                    topic, payload = parse_publish(header, body)
+                    broker.route(topic, payload, header & 1)
+                elif kind == 8:
+                    pid, i, granted, new = body[:2], 2, b"", []
+                    while i < len(body):
+                        n = struct.unpack("!H", body[i:i + 2])[0]
+                        new.append(body[i + 2:i + 2 + n].decode())
+                        i += 3 + n
+                        granted += b"\x00"
+                    self.filters.extend(new)
+                    self.send(packet(0x90, pid + granted))
+                    with broker.lock:
+                        retained = [(t, p) for t, p in broker.retained.items() if any(topic_matches(f, t) for f in new)]
+                    for t, p in retained:
+                        self.send(packet(0x31, encode_string(t) + p))
+                elif kind == 12:
+                    self.send(packet(0xD0, b""))
+                elif kind == 14:
+                    break
+        except (ConnectionError, OSError):
+            pass
+        finally:
+            with broker.lock:
+                broker.sessions.discard(self)
+
+    def send(self, data):
+        with self.send_lock:
+            try:
+                self.request.sendall(data)
+            except OSError:
+                pass
+
+
+# ========================================
+# Simulated board
+# ========================================
+class SimDevice:
+    """Same rules as handleLEDControl()/PendingCommands on the board."""
+
+    def __init__(self, args, name):
+        self.name = name
+        self.jitter_ms = args.jitter_ms
+        self.client = MqttClient(args.host, args.port, name, self.on_message)
+        self.client.subscribe("%s/group/%s/set" % (TOPIC_PREFIX, args.group), "%s/%s/set" % (TOPIC_PREFIX, name))
+
+    def on_message(self, topic, payload):
+        threading.Thread(target=self.handle, args=(payload,), daemon=True).start()
+
+    def handle(self, payload):
+        time.sleep(random.uniform(0, self.jitter_ms) / 1000.0)  # broker fan-out
+        try:
+            cmd = json.loads(payload)
+        except ValueError:
+            return
+        late = 0
+        if "at" in cmd:
+            # loop() polls every pass; sleep most of the way, then spin
+            while now_ms() < cmd["at"] - 2:
+                time.sleep(0.001)
+            while now_ms() < cmd["at"]:
+                pass
+            late = int(now_ms() - cmd["at"])
+        status = {"state": "on", "color": "custom", "timestamp": time.strftime("%Y-%m-%d %H:%M:%S"),
+                  "device": self.name, "late_ms": late}
+        self.client.publish(STATUS_TOPIC, json.dumps(status), retain=True)
+
+
+# ========================================
+# Check
+# ========================================
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument("--host", default="127.0.0.1")
+    ap.add_argument("--port", type=int, default=1883)
+    ap.add_argument("--serve", action="store_true", help="run the built-in broker on --port")
+    ap.add_argument("--group", default="all")
+    ap.add_argument("--sim", type=int, default=0, help="simulated boards to start")
+    ap.add_argument("--devices", type=int, default=0, help="boards expected to answer (default: --sim)")
+    ap.add_argument("--jitter-ms", type=float, default=80, help="max simulated delivery delay")
+    ap.add_argument("--lead-ms", type=int, default=500, help="how far ahead each target time is")
+    ap.add_argument("--rounds", type=int, default=5)
+    ap.add_argument("--tolerance-ms", type=int, default=10, help="max allowed late_ms spread")
+    args = ap.parse_args()
+    expected = args.devices or args.sim
+
+    if args.serve:
+        broker = Broker(args.port)
+        threading.Thread(target=broker.serve_forever, daemon=True).start()
+
+    sims = [SimDevice(args, "sim-%02d" % i) for i in range(args.sim)]
+
+    reports = {}
+    reports_lock = threading.Lock()
+
+    def on_status(topic, payload):
+        try:
+            msg = json.loads(payload)
+        except ValueError:
+            return  # CBOR or garbage
+        if "late_ms" in msg and "device" in msg:
+            with reports_lock:
+                reports[msg["device"]] = (now_ms(), msg["late_ms"])
+
+    monitor = MqttClient(args.host, args.port, "fleet-sync-check", on_status)
+    monitor.subscribe(STATUS_TOPIC)
+    time.sleep(0.5)
+
+    failed = False
+    colors = [(255, 0, 0), (0, 255, 0), (0, 0, 255)]
+    print("%5s %8s %10s %10s %10s" % ("round", "boards", "min late", "max late", "spread"))
+    for n in range(args.rounds):
+        r, g, b = colors[n % len(colors)]
+        at = now_ms() + args.lead_ms
+        with reports_lock:
+            reports.clear()
+        monitor.publish("%s/group/%s/set" % (TOPIC_PREFIX, args.group), json.dumps({"r": r, "g": g, "b": b, "at": at}))
+        # Boards publish their status within the coalescing window
+        time.sleep((args.lead_ms + 500) / 1000.0)
+        with reports_lock:
+            late = [l for (seen, l) in reports.values() if seen >= at]
+        if not late:
+            print("%5d %8d %10s %10s %10s" % (n + 1, 0, "-", "-", "-"))
+            failed = True
+            continue
+        spread = max(late) - min(late)
+        ok = spread <= args.tolerance_ms and (not expected or len(late) >= expected)
+        failed |= not ok
+        print("%5d %8d %10d %10d %10d%s" % (n + 1, len(late), min(late), max(late), spread, "" if ok else "  FAIL"))
+
+    monitor.close()
+    for s in sims:
+        s.client.close()
+    print("FAIL" if failed else "PASS")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
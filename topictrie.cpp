@@ -0,0 +1,172 @@
+#include "topictrie.h"
+#include <string.h>
+
+static_assert((TOPIC_TRIE_EDGES & (TOPIC_TRIE_EDGES - 1)) == 0, "TOPIC_TRIE_EDGES must be a power of two");
+static_assert(TOPIC_TRIE_EDGES >= TOPIC_TRIE_NODES, "every node but the root needs an edge slot");
+
+TopicTrie::TopicTrie() : nodeCount_(0), labelsUsed_(0) {
+  memset(edges_, 0, sizeof(edges_));
+  newNode();  // root
+}
+
+uint16_t TopicTrie::newNode() {
+  if (nodeCount_ >= TOPIC_TRIE_NODES) {
+    return NONE;
+  }
+  Node& n = nodes_[nodeCount_];
+  n.plus = NONE;
+  n.id = TOPIC_NO_MATCH;
+  n.hashId = TOPIC_NO_MATCH;
+  return nodeCount_++;
+}
+
+// FNV-1a over the level, mixed with the parent so equal labels under
+// different parents land in different slots
+uint32_t TopicTrie::hashLevel(uint16_t parent, const char* s, size_t len) {
+  uint32_t h = 2166136261u ^ (parent * 0x9E3779B1u);
+  for (size_t i = 0; i < len; i++) {
+    h = (h ^ (uint8_t)s[i]) * 16777619u;
+  }
+  return h;
+}
+
+uint16_t TopicTrie::findChild(uint16_t parent, const char* s, size_t len) const {
+  uint32_t h = hashLevel(parent, s, len);
+  for (uint16_t i = 0; i < TOPIC_TRIE_EDGES; i++) {
+    const Edge& e = edges_[(h + i) & (TOPIC_TRIE_EDGES - 1)];
+    if (e.child == 0) {
+      return NONE;
+    }
+    if (e.hash == h && e.parent == parent && e.length == len && memcmp(labels_ + e.label, s, len) == 0) {
+      return e.child;
+    }
+  }
+  return NONE;
+}
+
+uint16_t TopicTrie::addChild(uint16_t parent, const char* s, size_t len) {
+  uint16_t child = findChild(parent, s, len);
+  if (child != NONE) {
+    return child;
+  }
+  if (len > 0xFF || labelsUsed_ + len > sizeof(labels_)) {
+    return NONE;
+  }
+
+  uint32_t h = hashLevel(parent, s, len);
+  for (uint16_t i = 0; i < TOPIC_TRIE_EDGES; i++) {
+    Edge& e = edges_[(h + i) & (TOPIC_TRIE_EDGES - 1)];
+    if (e.child != 0) {
+      continue;
+    }
+    child = newNode();
+    if (child == NONE) {
+      return NONE;
+    }
+    memcpy(labels_ + labelsUsed_, s, len);
+    e.hash = h;
+    e.parent = parent;
+    e.child = child;
+    e.label = labelsUsed_;
+    e.length = len;
+    labelsUsed_ += len;
+    return child;
+  }
+  return NONE;
+}
+
+bool TopicTrie::add(const char* filter, uint8_t id) {
+  uint16_t node = 0;
+  const char* p = filter;
+  for (;;) {
+    const char* slash = strchr(p, '/');
+    size_t len = slash != nullptr ? (size_t)(slash - p) : strlen(p);
+
+    if (len == 1 && *p == '#') {
+      if (slash != nullptr) {
+        return false;
+      }
+      nodes_[node].hashId = id;
+      return true;
+    }
+    if (len == 1 && *p == '+') {
+      if (nodes_[node].plus == NONE) {
+        uint16_t plus = newNode();
+        if (plus == NONE) {
+          return false;
+        }
+        nodes_[node].plus = plus;
+      }
+      node = nodes_[node].plus;
+    } else {
+      if (memchr(p, '+', len) != nullptr || memchr(p, '#', len) != nullptr) {
+        return false;
+      }
+      node = addChild(node, p, len);
+      if (node == NONE) {
+        return false;
+      }
+    }
+
+    if (slash == nullptr) {
+      nodes_[node].id = id;
+      return true;
+    }
+    p = slash + 1;
+  }
+}
+
+uint8_t TopicTrie::match(const char* topic, size_t length, TopicMatch& m) const {
+  m.count = 0;
+  // Topics starting with '$' (broker internals) never match a wildcard at
+  // the first level, per the MQTT spec
+  if (length > 0 && topic[0] == '$') {
+    const char* slash = (const char*)memchr(topic, '/', length);
+    size_t len = slash != nullptr ? (size_t)(slash - topic) : length;
+    uint16_t child = findChild(0, topic, len);
+    return child == NONE ? TOPIC_NO_MATCH : matchFrom(child, slash != nullptr ? slash + 1 : nullptr, topic + length, m);
+  }
+  return matchFrom(0, topic, topic + length, m);
+}
+
+// p is the start of the next level, or nullptr once the topic is used up
+uint8_t TopicTrie::matchFrom(uint16_t node, const char* p, const char* end, TopicMatch& m) const {
+  const Node& n = nodes_[node];
+  if (p == nullptr) {
+    // "a/#" also matches "a" itself
+    return n.id != TOPIC_NO_MATCH ? n.id : n.hashId;
+  }
+
+  const char* slash = (const char*)memchr(p, '/', end - p);
+  size_t len = (slash != nullptr ? slash : end) - p;
+  const char* next = slash != nullptr ? slash + 1 : nullptr;
+
+  uint16_t child = findChild(node, p, len);
+  if (child != NONE) {
+    uint8_t id = matchFrom(child, next, end, m);
+    if (id != TOPIC_NO_MATCH) {
+      return id;
+    }
+  }
+
+  if (n.plus != NONE && m.count < TOPIC_MAX_WILDCARDS) {
+    uint8_t slot = m.count++;
+    m.wildcard[slot] = p;
+    m.wildcardLength[slot] = len > 0xFF ? 0xFF : len;
+    uint8_t id = matchFrom(n.plus, next, end, m);
+    if (id != TOPIC_NO_MATCH) {
+      return id;
+    }
+    m.count = slot;
+  }
+
+  if (n.hashId != TOPIC_NO_MATCH) {
+    if (m.count < TOPIC_MAX_WILDCARDS) {
+      m.wildcard[m.count] = p;
+      m.wildcardLength[m.count] = (end - p) > 0xFF ? 0xFF : (end - p);
+      m.count++;
+    }
+    return n.hashId;
+  }
+  return TOPIC_NO_MATCH;
+}
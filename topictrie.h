@@ -0,0 +1,75 @@
+#ifndef TOPICTRIE_H
+#define TOPICTRIE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+
+// MQTT topic filter matcher. Filters such as "home/led/+/set" or
+// "home/led/#" are stored level by level in a trie; the children of all
+// nodes live in one open-addressed table keyed on (parent, level hash), so
+// each level of an incoming topic costs one hash and usually one probe,
+// however many filters are registered. Nodes, edges and label text come
+// from fixed pools; matching works on the topic in place and never
+// allocates.
+//
+// When several filters match, the most specific wins: an exact level
+// beats "+", which beats "#". The text matched by each "+" and by "#" is
+// reported back in TopicMatch.
+
+const uint8_t TOPIC_NO_MATCH = 0xFF;
+
+struct TopicMatch {
+  const char* wildcard[TOPIC_MAX_WILDCARDS];
+  uint8_t wildcardLength[TOPIC_MAX_WILDCARDS];
+  uint8_t count;
+};
+
+class TopicTrie {
+ public:
+  TopicTrie();
+
+  // False if a pool is full or the filter is malformed ("#" not last,
+  // wildcards mixed with text inside one level)
+  bool add(const char* filter, uint8_t id);
+
+  // Id of the best matching filter, or TOPIC_NO_MATCH
+  uint8_t match(const char* topic, size_t length, TopicMatch& m) const;
+  uint8_t match(const char* topic, size_t length) const {
+    TopicMatch m;
+    return match(topic, length, m);
+  }
+
+  uint16_t nodeCount() const { return nodeCount_; }
+
+ private:
+  static const uint16_t NONE = 0xFFFF;
+
+  struct Node {
+    uint16_t plus;  // "+" child
+    uint8_t id;     // filter ending at this node
+    uint8_t hashId; // filter ending in "#" below this node
+  };
+
+  struct Edge {
+    uint32_t hash;
+    uint16_t parent;
+    uint16_t child;  // 0 = empty slot (the root is never a child)
+    uint16_t label;  // offset into labels_
+    uint8_t length;
+  };
+
+  static uint32_t hashLevel(uint16_t parent, const char* s, size_t len);
+  uint16_t findChild(uint16_t parent, const char* s, size_t len) const;
+  uint16_t addChild(uint16_t parent, const char* s, size_t len);
+  uint16_t newNode();
+  uint8_t matchFrom(uint16_t node, const char* p, const char* end, TopicMatch& m) const;
+
+  Node nodes_[TOPIC_TRIE_NODES];
+  Edge edges_[TOPIC_TRIE_EDGES];
+  char labels_[TOPIC_TRIE_LABEL_BYTES];
+  uint16_t nodeCount_;
+  uint16_t labelsUsed_;
+};
+
+#endif // TOPICTRIE_H
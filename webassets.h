@@ -0,0 +1,373 @@
+// Generated by tools/embed_assets.py from web/ - do not edit by hand
+#ifndef WEBASSETS_H
+#define WEBASSETS_H
+
+#include <Arduino.h>
+
+// web/login.html: 7288 bytes, 2413 gzipped
+#define LOGIN_HTML_ETAG "\"7e0282b82998055b\""
+const size_t LOGIN_HTML_GZ_LEN = 2413;
+const uint8_t LOGIN_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x59, 0x6b, 0x72, 0xe3, 0xc6,
+  0x11, 0xfe, 0xbf, 0xa7, 0x98, 0x85, 0x6a, 0x0d, 0x32, 0x26, 0xf8, 0x14, 0xb5, 0x5a, 0xbe, 0xaa,
+  0x64, 0x89, 0xeb, 0xa8, 0x6a, 0x77, 0xa5, 0x5a, 0x51, 0x76, 0xf9, 0xe7, 0x10, 0x18, 0x90, 0x63,
+  0x81, 0x00, 0x82, 0x19, 0x48, 0x62, 0xd6, 0x3a, 0x43, 0x92, 0x4a, 0xaa, 0xfc, 0x27, 0x55, 0x39,
+  0x44, 0x6e, 0xe4, 0x13, 0xe4, 0x08, 0xe9, 0x79, 0x81, 0x03, 0x10, 0xd4, 0x7a, 0x9d, 0xb8, 0xf4,
+  0x83, 0x03, 0x4c, 0x77, 0x4f, 0x3f, 0xbf, 0xee, 0x81, 0x26, 0x2f, 0x2f, 0xae, 0xce, 0x17, 0x3f,
+  0x5c, 0xcf, 0xd1, 0x9a, 0x6f, 0xa2, 0xd9, 0x8b, 0x89, 0xf9, 0x21, 0x38, 0x98, 0xbd, 0x40, 0x68,
+  0xb2, 0x21, 0x1c, 0x23, 0x7f, 0x8d, 0x33, 0x46, 0xf8, 0xd4, 0xb9, 0x5d, 0xbc, 0xf5, 0x4e, 0x9d,
+  0xdd, 0x46, 0x8c, 0x37, 0x64, 0xea, 0xdc, 0x53, 0xf2, 0x90, 0x26, 0x19, 0x77, 0x90, 0x9f, 0xc4,
+  0x9c, 0xc4, 0x40, 0xf8, 0x40, 0x03, 0xbe, 0x9e, 0x06, 0xe4, 0x9e, 0xfa, 0xc4, 0x93, 0x0f, 0x2d,
+  0x44, 0x63, 0xca, 0x29, 0x8e, 0x3c, 0xe6, 0xe3, 0x88, 0x4c, 0x7b, 0xed, 0xae, 0x12, 0xc4, 0x29,
+  0x8f, 0xc8, 0x6c, 0x7e, 0x73, 0x3d, 0xe8, 0xa3, 0x77, 0xf3, 0x0b, 0xe4, 0xa1, 0x77, 0xc9, 0x8a,
+  0xc6, 0x93, 0x8e, 0xda, 0x10, 0x24, 0x8c, 0x6f, 0xd5, 0x0a, 0xa1, 0x3f, 0xa0, 0x4f, 0x68, 0x83,
+  0x33, 0x20, 0x18, 0xa1, 0xee, 0x18, 0xa5, 0x38, 0x08, 0x68, 0xbc, 0x92, 0xeb, 0x65, 0xf2, 0xe8,
+  0x31, 0xfa, 0x67, 0xf9, 0xb8, 0x4c, 0xb2, 0x80, 0x64, 0x1e, 0xbc, 0x1a, 0xa3, 0x27, 0xc9, 0xb8,
+  0x4c, 0x82, 0x2d, 0xf0, 0xca, 0x35, 0x42, 0x21, 0x28, 0xea, 0x85, 0x78, 0x43, 0xa3, 0xed, 0x08,
+  0xb9, 0x37, 0x64, 0x95, 0x10, 0x74, 0x7b, 0xe9, 0xb6, 0xd0, 0x59, 0x06, 0x2a, 0xb6, 0x10, 0xc3,
+  0x31, 0xf3, 0x18, 0xc9, 0x68, 0x38, 0xd6, 0x1c, 0x4b, 0xec, 0xdf, 0xad, 0xb2, 0x24, 0x8f, 0x83,
+  0x11, 0x8a, 0x68, 0x4c, 0x70, 0xe6, 0xad, 0x32, 0x1c, 0x50, 0x30, 0xb7, 0xd1, 0x1b, 0x0c, 0x03,
+  0xb2, 0x6a, 0xa1, 0xa3, 0x93, 0x93, 0xd7, 0x84, 0x60, 0xd4, 0x7d, 0x05, 0xeb, 0xd7, 0x27, 0xc7,
+  0x4b, 0xdc, 0x47, 0xbd, 0x6e, 0xf7, 0x55, 0xd3, 0x08, 0xd9, 0xd0, 0xd8, 0x5b, 0x13, 0xba, 0x5a,
+  0xf3, 0x91, 0xd8, 0xb8, 0x5f, 0x9b, 0x8d, 0x80, 0xb2, 0x34, 0xc2, 0xa0, 0x4b, 0x18, 0x91, 0x47,
+  0xf3, 0x12, 0x47, 0x74, 0x15, 0x7b, 0x94, 0x93, 0x0d, 0x1b, 0x21, 0x1f, 0x0e, 0x22, 0x99, 0xd9,
+  0xfa, 0x31, 0x67, 0x9c, 0x86, 0x5b, 0x4f, 0x3b, 0xbc, 0xba, 0x5d, 0xb8, 0xa5, 0xdf, 0x4d, 0xb5,
+  0x38, 0xe5, 0x85, 0x76, 0x24, 0x7c, 0x2b, 0xd9, 0x30, 0x18, 0x91, 0xa1, 0x4f, 0x35, 0xe6, 0x3d,
+  0xac, 0xe1, 0xcc, 0x3d, 0x51, 0xc7, 0x85, 0x28, 0x64, 0xdc, 0x2b, 0xec, 0xcf, 0x41, 0xb7, 0xde,
+  0xd0, 0xde, 0x82, 0x28, 0xac, 0x71, 0x90, 0x3c, 0x40, 0x50, 0xc0, 0xc8, 0xf4, 0x51, 0x72, 0xa2,
+  0x6c, 0xb5, 0xc4, 0x8d, 0x6e, 0x4b, 0xfe, 0xb5, 0xfb, 0x85, 0x47, 0x64, 0x6e, 0x48, 0x67, 0xbc,
+  0x2a, 0x9c, 0x84, 0x1f, 0x3d, 0xfd, 0xfa, 0x78, 0x58, 0xd1, 0x7f, 0xdd, 0x83, 0x18, 0xfa, 0x49,
+  0x94, 0x64, 0x23, 0x74, 0x34, 0x18, 0x0c, 0xc6, 0x3a, 0x19, 0x20, 0xd2, 0x9c, 0x27, 0x9b, 0x91,
+  0x3c, 0x70, 0x8c, 0x38, 0x79, 0xe4, 0x9e, 0x74, 0x5f, 0xe1, 0x19, 0xe3, 0x00, 0x96, 0x2f, 0x65,
+  0x62, 0x59, 0x72, 0x4e, 0x4e, 0x4e, 0xea, 0x59, 0x2a, 0xb2, 0x07, 0x52, 0xb6, 0x4c, 0x1d, 0xc8,
+  0x33, 0x02, 0x87, 0x1d, 0xa7, 0x45, 0x7e, 0xb5, 0xc3, 0x24, 0xdb, 0x78, 0xc2, 0x85, 0x69, 0x91,
+  0xa2, 0x05, 0xa7, 0x0c, 0x83, 0x26, 0x8c, 0xf0, 0x92, 0x44, 0x40, 0x52, 0x84, 0x7c, 0x19, 0x25,
+  0xfe, 0xdd, 0xde, 0x61, 0xc2, 0xa5, 0x85, 0x86, 0xc3, 0xe1, 0x50, 0x1f, 0xfc, 0xa0, 0xb3, 0x67,
+  0xd8, 0xed, 0x1a, 0x81, 0x34, 0x4e, 0x73, 0x5e, 0x04, 0xb2, 0xc6, 0xa1, 0x45, 0x08, 0x7b, 0xfd,
+  0x6a, 0x08, 0x41, 0x35, 0x88, 0x0d, 0x4b, 0x22, 0x1a, 0xa0, 0xa3, 0x20, 0x08, 0x0e, 0x04, 0xf8,
+  0x74, 0xc7, 0x67, 0x9b, 0x7f, 0xb2, 0x7b, 0xcd, 0x33, 0xa8, 0x18, 0xa8, 0xef, 0x24, 0x2e, 0x8a,
+  0x4f, 0x2a, 0x8f, 0xba, 0xed, 0x01, 0xb3, 0x23, 0x28, 0xb5, 0x1d, 0x85, 0x89, 0x9f, 0x33, 0x70,
+  0x42, 0x92, 0x73, 0x51, 0x4c, 0x23, 0x14, 0x27, 0x31, 0x19, 0x97, 0x38, 0x47, 0xa6, 0x9c, 0x0a,
+  0x0f, 0x2f, 0x73, 0x70, 0x4d, 0xfc, 0xeb, 0x2c, 0x3d, 0xb6, 0x2c, 0xfd, 0x7f, 0x54, 0xae, 0x56,
+  0xa9, 0x54, 0x1a, 0xc6, 0x85, 0x52, 0xf7, 0xdf, 0xea, 0xb8, 0x52, 0x54, 0x4f, 0x20, 0xaa, 0xe6,
+  0xc0, 0x3c, 0x63, 0xe2, 0xc4, 0x34, 0xa1, 0x76, 0x65, 0xdb, 0x7e, 0x96, 0x6b, 0x91, 0x76, 0xe0,
+  0xe4, 0x3e, 0x6b, 0x59, 0xa5, 0x27, 0x5f, 0x94, 0xea, 0x5e, 0xf9, 0x6e, 0xb4, 0x4e, 0xee, 0xad,
+  0xa2, 0x2f, 0x04, 0x68, 0x59, 0x11, 0xe6, 0xe4, 0x87, 0x86, 0x07, 0x29, 0xd1, 0xac, 0x2f, 0x67,
+  0x48, 0x4a, 0x99, 0xcb, 0xaa, 0x9a, 0x7b, 0xdd, 0x7e, 0x0b, 0x72, 0xea, 0xa4, 0x85, 0xfa, 0x83,
+  0xe3, 0x16, 0x9c, 0x79, 0xdc, 0xac, 0x3b, 0x13, 0xfb, 0x9c, 0xde, 0x8b, 0x7a, 0xab, 0x3f, 0xae,
+  0xdb, 0x34, 0x01, 0x3e, 0xda, 0x10, 0xc6, 0xf0, 0x8a, 0x14, 0xfa, 0xe9, 0x92, 0xe0, 0x49, 0x5a,
+  0xc6, 0x98, 0x67, 0x12, 0xba, 0xce, 0xf3, 0x35, 0xa5, 0x5d, 0x85, 0xdd, 0x5d, 0x08, 0xb5, 0xee,
+  0x24, 0xcb, 0x20, 0x79, 0x3f, 0x95, 0x92, 0xe7, 0x28, 0x24, 0x64, 0x57, 0x93, 0xbe, 0x40, 0x9f,
+  0x6a, 0x11, 0x17, 0x20, 0xe3, 0xfb, 0x60, 0x4b, 0x95, 0x9f, 0x84, 0x16, 0xff, 0xc0, 0x3f, 0xcc,
+  0xef, 0x67, 0x24, 0x00, 0x45, 0xa1, 0x15, 0xb1, 0x5a, 0x67, 0xf4, 0xbb, 0x75, 0xce, 0x18, 0xd6,
+  0xe7, 0xfc, 0x51, 0x38, 0x14, 0x7f, 0x5f, 0x96, 0xa1, 0x96, 0x63, 0x6d, 0x98, 0xb4, 0x5d, 0x64,
+  0x2b, 0xc9, 0x78, 0x96, 0xc4, 0xab, 0x2a, 0x36, 0x7f, 0x06, 0xe2, 0x4e, 0x2d, 0xf4, 0x14, 0xc2,
+  0xbc, 0x0c, 0x32, 0xb7, 0x68, 0xd1, 0x85, 0x5d, 0x50, 0x2c, 0xa2, 0xbd, 0x97, 0xd5, 0x2f, 0xf0,
+  0x7e, 0x07, 0x5f, 0xa4, 0x2b, 0xfe, 0xf6, 0x54, 0x14, 0x52, 0x47, 0x11, 0x66, 0xdc, 0xf3, 0xd7,
+  0x34, 0x0a, 0x44, 0x4c, 0xca, 0x22, 0x14, 0xf4, 0x68, 0x8e, 0x2c, 0x89, 0x88, 0xb7, 0xc4, 0x81,
+  0x95, 0x85, 0x85, 0x15, 0x34, 0x16, 0xf0, 0xe1, 0x29, 0x63, 0xf6, 0x3a, 0x2d, 0x28, 0x72, 0x7a,
+  0xb8, 0x43, 0x76, 0xeb, 0xdd, 0xdc, 0x3d, 0x00, 0x04, 0xcb, 0x24, 0x0a, 0xc6, 0xe5, 0xc0, 0x47,
+  0x24, 0xe4, 0x56, 0xb8, 0x4c, 0x8d, 0x09, 0x55, 0x3d, 0x1c, 0xc0, 0x64, 0xb1, 0x97, 0xad, 0xe1,
+  0xf0, 0x75, 0xbf, 0x3f, 0x2e, 0x43, 0x57, 0x99, 0x6f, 0x93, 0x04, 0xfb, 0x5c, 0x6f, 0x4e, 0x45,
+  0x6f, 0x79, 0x86, 0x4b, 0xcc, 0x7b, 0x64, 0xaf, 0x38, 0xfa, 0xbd, 0x37, 0x27, 0x6f, 0x07, 0xcf,
+  0x32, 0xae, 0x72, 0xc2, 0x78, 0x95, 0xef, 0x0d, 0x11, 0x7f, 0x75, 0x7c, 0x93, 0x8e, 0x1e, 0xfc,
+  0x26, 0x1d, 0x35, 0x8f, 0x4e, 0xc4, 0x10, 0x27, 0x27, 0xc2, 0x80, 0xde, 0x23, 0x1f, 0x82, 0xca,
+  0xa6, 0x4e, 0x65, 0xa2, 0x71, 0xd4, 0x9c, 0x38, 0x59, 0xf7, 0x66, 0xff, 0xf9, 0xd7, 0x3f, 0xfe,
+  0x8a, 0x76, 0x83, 0xe5, 0x39, 0x90, 0x40, 0x78, 0x41, 0x58, 0x4f, 0xd3, 0xa4, 0x46, 0x86, 0x19,
+  0x0a, 0x9c, 0xd9, 0x47, 0x11, 0xff, 0x6f, 0x30, 0x23, 0x01, 0x3a, 0x53, 0x35, 0xac, 0xd9, 0xd0,
+  0xcd, 0x96, 0xc1, 0x24, 0x36, 0xe9, 0xa4, 0x8a, 0x59, 0x49, 0x90, 0xe8, 0x4b, 0x03, 0xad, 0xc5,
+  0x5b, 0x78, 0x72, 0x50, 0x12, 0x83, 0xb8, 0x0d, 0x85, 0x29, 0x38, 0x23, 0x3c, 0xcf, 0x62, 0xb4,
+  0xc6, 0x71, 0x10, 0x11, 0x39, 0xd5, 0x36, 0xc8, 0x3d, 0x94, 0x4c, 0x53, 0x2b, 0x59, 0x36, 0x64,
+  0x37, 0x40, 0x14, 0xdb, 0x40, 0xa0, 0xc6, 0x05, 0xd8, 0x9b, 0x3a, 0x39, 0x0c, 0xa4, 0x62, 0xe2,
+  0x76, 0x66, 0xb7, 0x7a, 0x35, 0xe9, 0xc8, 0x6d, 0x8b, 0x5c, 0x0d, 0x03, 0x7c, 0x9b, 0xc2, 0x5c,
+  0x2e, 0x70, 0xcf, 0x91, 0xda, 0x15, 0x9c, 0x7a, 0x62, 0xdf, 0x3d, 0x67, 0xe4, 0x4f, 0x39, 0x85,
+  0x2a, 0x41, 0x38, 0xe7, 0x89, 0x9f, 0x6c, 0xd2, 0x88, 0x70, 0x9b, 0xa0, 0x50, 0xb4, 0x03, 0x9a,
+  0xfe, 0x26, 0xad, 0x53, 0x20, 0x7b, 0x80, 0x6a, 0x70, 0x66, 0xd7, 0x7a, 0xf5, 0xbc, 0xd6, 0x05,
+  0xbd, 0xd4, 0x7c, 0xf7, 0xa4, 0x34, 0xdf, 0x3d, 0x1f, 0xd0, 0x1c, 0xfa, 0x66, 0x06, 0x2e, 0xf6,
+  0x76, 0xc7, 0xd6, 0x5a, 0xa0, 0x67, 0x09, 0x75, 0xa4, 0x8a, 0x97, 0x63, 0x4c, 0x52, 0x7b, 0xce,
+  0x4c, 0xdf, 0x43, 0xd4, 0xa3, 0x4e, 0x99, 0x8e, 0xb0, 0xd7, 0xce, 0x00, 0xe1, 0x0a, 0xa1, 0xa8,
+  0xee, 0x5d, 0xce, 0xcc, 0x3a, 0xe7, 0x45, 0xd5, 0x59, 0x16, 0x64, 0xee, 0xf4, 0x52, 0xd8, 0x29,
+  0xb2, 0xf5, 0x6f, 0x68, 0x21, 0x0a, 0x04, 0x12, 0x0f, 0x6a, 0x83, 0x33, 0xf4, 0x15, 0xba, 0x26,
+  0xd9, 0x86, 0x32, 0x06, 0xed, 0x9e, 0x8d, 0x44, 0x39, 0x48, 0xca, 0x9a, 0x28, 0x18, 0xa0, 0xb3,
+  0x63, 0xc0, 0x52, 0x1c, 0x9b, 0x7d, 0x0b, 0xd6, 0x2c, 0xc4, 0x70, 0x66, 0x67, 0x17, 0xef, 0x2f,
+  0x3f, 0x80, 0x60, 0x20, 0x9d, 0x21, 0x85, 0x22, 0x1d, 0xf5, 0xdb, 0xeb, 0x0f, 0x26, 0xcb, 0xcc,
+  0x16, 0xb7, 0xc1, 0x51, 0x84, 0x64, 0x45, 0xc2, 0x79, 0x1a, 0xe6, 0x4f, 0x4f, 0x4f, 0xc7, 0xce,
+  0xec, 0x97, 0x7f, 0xfe, 0x1d, 0xbd, 0xcd, 0x61, 0xd7, 0xd4, 0xca, 0xd7, 0xe8, 0x86, 0x70, 0x0e,
+  0xb8, 0xc8, 0x40, 0xb6, 0xe0, 0xfb, 0x6c, 0x1a, 0x7d, 0xb1, 0x01, 0x00, 0x5d, 0xce, 0xec, 0xfd,
+  0xd5, 0x85, 0x51, 0x1e, 0x9e, 0x49, 0x86, 0x39, 0x34, 0xed, 0x8e, 0x58, 0x7f, 0xa9, 0xfa, 0x16,
+  0x40, 0x80, 0xf6, 0xdf, 0x01, 0xc2, 0x89, 0x6b, 0xe8, 0xef, 0xa7, 0xbe, 0xc2, 0x50, 0x67, 0xf6,
+  0xdd, 0xe5, 0xfc, 0x7b, 0x63, 0x82, 0xc6, 0xd5, 0x8e, 0x5c, 0x7c, 0xa9, 0x01, 0x52, 0xe5, 0x1b,
+  0x8e, 0x39, 0xcc, 0xd5, 0x5f, 0x4b, 0xdd, 0xd1, 0x55, 0x1c, 0x6d, 0x7f, 0x37, 0x03, 0x24, 0x96,
+  0x3b, 0xb3, 0x6f, 0x6f, 0xe7, 0x37, 0x0b, 0x63, 0x80, 0xc2, 0xf7, 0x8e, 0xfa, 0xfd, 0x5f, 0x0c,
+  0x78, 0x5e, 0xf3, 0x62, 0xa9, 0x17, 0xf2, 0x13, 0x81, 0x9f, 0xd1, 0x94, 0xab, 0xfd, 0x30, 0x8f,
+  0x7d, 0x31, 0x21, 0x97, 0x81, 0xb7, 0x59, 0x34, 0x74, 0xd2, 0x4e, 0x33, 0x89, 0xc3, 0x17, 0x24,
+  0xc4, 0x79, 0xc4, 0x1b, 0xc5, 0xb4, 0x5b, 0x4c, 0x3c, 0x31, 0xd8, 0x61, 0x30, 0x10, 0x4d, 0x51,
+  0x00, 0xd7, 0x95, 0x0d, 0x30, 0xb4, 0x57, 0x84, 0xcf, 0x23, 0x22, 0x96, 0xdf, 0x6c, 0x2f, 0x83,
+  0x86, 0x6b, 0x68, 0xdc, 0x66, 0xfb, 0x1e, 0x47, 0x39, 0x19, 0x97, 0x24, 0x18, 0x0c, 0x7a, 0x4e,
+  0x82, 0xa1, 0xa9, 0x97, 0x60, 0x26, 0xe2, 0x67, 0x04, 0x68, 0x12, 0xb7, 0xce, 0x08, 0x08, 0x9a,
+  0xb8, 0xf1, 0x37, 0xdc, 0xe9, 0x74, 0x8a, 0xde, 0x5d, 0x7d, 0x7b, 0xf9, 0x01, 0x9d, 0x2d, 0x16,
+  0xf3, 0xf7, 0xd7, 0x0b, 0x04, 0x6f, 0xdc, 0xe6, 0xb8, 0x8e, 0xd6, 0x34, 0x97, 0x91, 0xdb, 0x2a,
+  0x7c, 0x50, 0x4f, 0x69, 0x00, 0x1d, 0x45, 0x24, 0x5e, 0xc1, 0x5d, 0x0c, 0x18, 0x8c, 0x39, 0x6d,
+  0xf5, 0xaa, 0xaa, 0x94, 0x56, 0xb6, 0x2d, 0x5a, 0xd3, 0xb9, 0xfa, 0x76, 0x01, 0xb6, 0xb9, 0xbf,
+  0xfc, 0xe5, 0xdf, 0xe8, 0x2c, 0xe7, 0x6b, 0x81, 0x8d, 0x3e, 0x16, 0xc0, 0xd1, 0x6e, 0xb7, 0xdd,
+  0x71, 0x85, 0x49, 0xa6, 0xe2, 0x07, 0x15, 0x11, 0x77, 0x6f, 0x57, 0x26, 0x56, 0x5b, 0x0f, 0x6b,
+  0x82, 0x42, 0xce, 0x69, 0x6e, 0x6d, 0x68, 0x05, 0x88, 0x5f, 0x60, 0x8e, 0x05, 0x99, 0x31, 0x71,
+  0xea, 0x42, 0xdd, 0x90, 0xd8, 0x07, 0x1c, 0xb9, 0xfd, 0x78, 0x79, 0x0e, 0x0d, 0x05, 0xe6, 0x42,
+  0xb8, 0x22, 0x16, 0x2e, 0x80, 0x6d, 0xf7, 0x2b, 0x63, 0xdf, 0x21, 0x6a, 0xb3, 0x5f, 0xef, 0xb0,
+  0x1b, 0x12, 0x8b, 0x69, 0x11, 0x5d, 0x5f, 0xdd, 0x2c, 0x10, 0x4f, 0x50, 0x47, 0x8e, 0x0d, 0x7b,
+  0xa1, 0x0b, 0x09, 0xf7, 0xd7, 0x0d, 0x57, 0xef, 0xb6, 0x8a, 0xc4, 0x15, 0xc6, 0xf2, 0x75, 0x02,
+  0x53, 0x93, 0x2b, 0x24, 0xb8, 0xad, 0xe2, 0xbd, 0x98, 0x8f, 0x48, 0x06, 0x83, 0xe6, 0x27, 0xe4,
+  0x6a, 0xbf, 0x7a, 0x0b, 0xe8, 0x6d, 0x2e, 0x90, 0xe2, 0x34, 0x8d, 0xa4, 0x57, 0x93, 0xb8, 0xf3,
+  0xe8, 0x3d, 0x3c, 0x3c, 0x78, 0xb2, 0x67, 0xe7, 0x59, 0xa4, 0xf4, 0x0f, 0x5c, 0xf4, 0xb4, 0x93,
+  0x24, 0x46, 0xac, 0x51, 0xe1, 0xa0, 0xdd, 0x7b, 0xab, 0x75, 0x81, 0x4c, 0x1a, 0xfb, 0x51, 0x1e,
+  0x10, 0x57, 0x6f, 0x3f, 0x35, 0xf5, 0xa2, 0x2d, 0x62, 0xd8, 0xc8, 0x08, 0x03, 0x77, 0x30, 0x88,
+  0xd3, 0xcc, 0xd2, 0xbd, 0xe4, 0x89, 0x8f, 0x86, 0x24, 0x23, 0x3e, 0x81, 0xeb, 0x61, 0xb0, 0x73,
+  0x42, 0xd5, 0x67, 0x12, 0x12, 0x44, 0x6e, 0x19, 0xb1, 0x10, 0x6a, 0xf1, 0xca, 0x62, 0xa8, 0xe7,
+  0xfc, 0xa3, 0x76, 0x8a, 0x2d, 0xba, 0x90, 0xa1, 0x3d, 0x26, 0x3e, 0xdb, 0xcc, 0x31, 0x78, 0xbb,
+  0x21, 0xab, 0xaf, 0x85, 0xee, 0xc8, 0xb6, 0x59, 0xd6, 0xbb, 0x22, 0x15, 0x21, 0x11, 0x7a, 0x20,
+  0x13, 0xf9, 0x20, 0xd4, 0x92, 0x8c, 0xd6, 0x11, 0x4f, 0x75, 0x8a, 0x75, 0x3a, 0xe8, 0x7c, 0x4d,
+  0xfc, 0x3b, 0x44, 0x43, 0xd1, 0x1b, 0xbd, 0xf3, 0x24, 0xb9, 0xa3, 0x44, 0xc7, 0x0d, 0x51, 0x86,
+  0x00, 0x92, 0x18, 0xf8, 0xb7, 0x64, 0x09, 0x47, 0x8c, 0x70, 0x4d, 0x39, 0xdd, 0x57, 0x1d, 0x90,
+  0xa0, 0xe1, 0x02, 0x05, 0x0c, 0xbf, 0x82, 0xe4, 0xb0, 0x07, 0xab, 0xe7, 0x09, 0xad, 0x0b, 0xc9,
+  0x75, 0xda, 0x82, 0x92, 0x8d, 0x97, 0xc5, 0x79, 0xc9, 0x5d, 0xb3, 0xe4, 0x0e, 0xbe, 0x16, 0x17,
+  0xb5, 0x18, 0xe0, 0x7a, 0x2e, 0x6e, 0xc9, 0xe0, 0xe8, 0xc5, 0xe2, 0x5a, 0x7a, 0xe5, 0x70, 0x84,
+  0x9e, 0xf6, 0x0f, 0xd1, 0xd3, 0x71, 0xc1, 0xf3, 0x23, 0x4b, 0xe2, 0x1d, 0x14, 0x57, 0x52, 0x2a,
+  0x90, 0xd5, 0xfa, 0xf9, 0x74, 0x12, 0x74, 0xc2, 0x3c, 0xf1, 0x7b, 0xc8, 0x32, 0xb1, 0x67, 0xae,
+  0xe8, 0xcd, 0xc3, 0x81, 0x96, 0x63, 0x81, 0xa8, 0x40, 0xa4, 0x69, 0xc3, 0x3c, 0x7a, 0x69, 0x3b,
+  0xb9, 0x42, 0xbf, 0x48, 0xee, 0x48, 0x8c, 0x00, 0x01, 0x32, 0x51, 0x25, 0x4d, 0xa3, 0x45, 0x9b,
+  0x8b, 0xf7, 0x25, 0xb6, 0x43, 0x28, 0x58, 0x77, 0x20, 0xbc, 0xc1, 0x12, 0x33, 0x02, 0xcc, 0xd6,
+  0xcb, 0x04, 0x03, 0xb4, 0x5a, 0xd0, 0x78, 0x10, 0x1e, 0xb5, 0x84, 0x12, 0xa1, 0xb5, 0xb4, 0xd3,
+  0x51, 0x65, 0x0f, 0x43, 0x38, 0x23, 0x80, 0x68, 0x78, 0x19, 0x91, 0xc0, 0xa2, 0x2c, 0xfa, 0x8e,
+  0x6f, 0xf2, 0x10, 0xee, 0x15, 0x8c, 0x4f, 0x7b, 0x4e, 0xd5, 0x11, 0xdc, 0x48, 0x9a, 0x2b, 0x21,
+  0x76, 0xd3, 0x52, 0x3b, 0x6d, 0x1a, 0x07, 0xe4, 0xf1, 0x2a, 0x6c, 0x28, 0x11, 0x4e, 0x13, 0xbd,
+  0x84, 0xbe, 0xe4, 0xf5, 0x0e, 0xba, 0xf4, 0x5c, 0xab, 0xa6, 0xd5, 0x12, 0x2e, 0x2d, 0x9f, 0xd1,
+  0x3c, 0x6c, 0xdf, 0x65, 0x0c, 0x90, 0x25, 0x2f, 0x72, 0x9c, 0x6e, 0x48, 0x22, 0xee, 0x17, 0x09,
+  0xea, 0x0d, 0xbb, 0xdd, 0x0d, 0x13, 0xf0, 0x86, 0x96, 0x30, 0xa1, 0x42, 0xe9, 0x65, 0x24, 0xa2,
+  0x78, 0x49, 0x23, 0xca, 0xb7, 0x87, 0xb4, 0xf8, 0x1e, 0x53, 0xd1, 0x92, 0x6c, 0x66, 0xed, 0x0c,
+  0x90, 0xb8, 0x24, 0xa2, 0x94, 0x44, 0x4c, 0x4a, 0xba, 0xc0, 0xbb, 0x85, 0x3a, 0xb6, 0x61, 0xc6,
+  0x91, 0x46, 0x39, 0xd7, 0xaa, 0xa6, 0xaa, 0x7b, 0x8b, 0xb1, 0x4f, 0x66, 0x4f, 0xd9, 0x7b, 0x25,
+  0xf9, 0x7b, 0xf9, 0x1f, 0xc0, 0x5d, 0xc8, 0x97, 0x6a, 0x8a, 0xbe, 0x52, 0x24, 0x0b, 0x8a, 0x93,
+  0x87, 0x3d, 0xe5, 0xc4, 0xb7, 0xd3, 0x38, 0x80, 0x0d, 0xe8, 0x90, 0xb2, 0x2f, 0xb4, 0xd7, 0x19,
+  0x09, 0x45, 0xda, 0xec, 0x18, 0x4b, 0x99, 0xf3, 0xd4, 0x92, 0xc6, 0xdb, 0xf5, 0x8c, 0x48, 0xc4,
+  0xc8, 0x73, 0xc5, 0xf3, 0xb3, 0xce, 0xe5, 0x10, 0x53, 0x1d, 0x3a, 0x59, 0x0d, 0x3a, 0x5b, 0x7f,
+  0x5d, 0x3d, 0xfc, 0x2c, 0x51, 0xa5, 0x61, 0x33, 0xa2, 0x9f, 0x7e, 0x42, 0xee, 0x65, 0x0c, 0xa0,
+  0x4b, 0x03, 0xbb, 0x29, 0xb9, 0xcd, 0xcf, 0xd6, 0x84, 0xfc, 0xa6, 0xe7, 0xee, 0x63, 0xd2, 0x0e,
+  0x6a, 0xc0, 0x1b, 0xd0, 0x0a, 0xd4, 0xb7, 0xbf, 0x5a, 0xb0, 0x21, 0x0a, 0xf0, 0x94, 0x65, 0xf2,
+  0x41, 0x18, 0x26, 0x17, 0xd6, 0xf9, 0xcf, 0xd8, 0x03, 0x8f, 0x31, 0x51, 0xd3, 0xa9, 0x62, 0x97,
+  0x16, 0xca, 0xa5, 0xb1, 0x70, 0x5f, 0xce, 0x33, 0x56, 0x3c, 0x55, 0x67, 0x07, 0x8d, 0xaa, 0x21,
+  0xb8, 0xa4, 0xf4, 0x45, 0xf3, 0xc5, 0x5e, 0x88, 0x94, 0x11, 0xa9, 0xf0, 0x69, 0x04, 0x18, 0x03,
+  0x85, 0xb2, 0x83, 0x9d, 0x68, 0x6b, 0xfc, 0xf9, 0xb9, 0x7a, 0x8c, 0xf1, 0x3d, 0x5d, 0x89, 0x7b,
+  0x97, 0xce, 0x52, 0xbb, 0x30, 0x61, 0x84, 0xd7, 0x63, 0x39, 0xdc, 0xa2, 0xe5, 0xa7, 0x9b, 0x49,
+  0x47, 0xfd, 0x83, 0xf1, 0xbf, 0x73, 0xf7, 0x06, 0x15, 0x78, 0x1c, 0x00, 0x00,
+};
+
+// web/dashboard.html: 10768 bytes, 3243 gzipped
+#define DASHBOARD_HTML_ETAG "\"a248cc1e3199b3c8\""
+const size_t DASHBOARD_HTML_GZ_LEN = 3243;
+const uint8_t DASHBOARD_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x5a, 0x5b, 0x6f, 0xdc, 0xc6,
+  0x15, 0x7e, 0xcf, 0xaf, 0x98, 0xc8, 0x2e, 0x96, 0xdb, 0x68, 0xb9, 0x17, 0x5d, 0x2a, 0xef, 0xae,
+  0x14, 0x58, 0xb2, 0x94, 0xa4, 0x70, 0x6c, 0x21, 0x52, 0x5b, 0x04, 0x86, 0x81, 0xcc, 0x92, 0xb3,
+  0xbb, 0x63, 0x73, 0x49, 0x7a, 0x66, 0x56, 0xb2, 0x12, 0xf8, 0xb1, 0x2f, 0x6d, 0xd1, 0x16, 0x49,
+  0x80, 0xbe, 0xb4, 0x28, 0xfa, 0x07, 0xfa, 0xd2, 0x7f, 0xd4, 0x5f, 0xd0, 0x9f, 0xd0, 0x73, 0xe6,
+  0x42, 0x0e, 0x2f, 0x2b, 0x2b, 0xae, 0x9e, 0x0a, 0x01, 0x5a, 0x92, 0x73, 0xce, 0x99, 0x33, 0xe7,
+  0xfa, 0xcd, 0x90, 0xd3, 0x8f, 0x9f, 0x3c, 0x3f, 0xb9, 0xfc, 0xfa, 0xfc, 0x94, 0x2c, 0xd5, 0x2a,
+  0x39, 0xfa, 0x68, 0xea, 0x7e, 0x18, 0x8d, 0x8f, 0x3e, 0x22, 0x64, 0xba, 0x62, 0x8a, 0x92, 0x68,
+  0x49, 0x85, 0x64, 0xea, 0x70, 0xeb, 0x57, 0x97, 0x67, 0xbd, 0x83, 0xad, 0x72, 0x20, 0xa5, 0x2b,
+  0x76, 0xb8, 0x75, 0xc5, 0xd9, 0x75, 0x9e, 0x09, 0xb5, 0x45, 0xa2, 0x2c, 0x55, 0x2c, 0x05, 0xc2,
+  0x6b, 0x1e, 0xab, 0xe5, 0x61, 0xcc, 0xae, 0x78, 0xc4, 0x7a, 0xfa, 0x66, 0x9b, 0xf0, 0x94, 0x2b,
+  0x4e, 0x93, 0x9e, 0x8c, 0x68, 0xc2, 0x0e, 0x87, 0xe1, 0xc0, 0x08, 0x52, 0x5c, 0x25, 0xec, 0xe8,
+  0xf4, 0xe2, 0x7c, 0x67, 0x44, 0x9e, 0x9e, 0x3e, 0x21, 0x4f, 0xa8, 0x5c, 0xce, 0x32, 0x2a, 0xe2,
+  0x69, 0xdf, 0x0c, 0x21, 0x91, 0x54, 0x37, 0xe6, 0x8a, 0x90, 0x9f, 0x93, 0xef, 0xc8, 0x8a, 0x8a,
+  0x05, 0x4f, 0xc7, 0x64, 0x30, 0x21, 0x39, 0x8d, 0x63, 0x9e, 0x2e, 0xf4, 0xf5, 0x2c, 0x7b, 0xdb,
+  0x93, 0xfc, 0x5b, 0x7d, 0x3b, 0xcb, 0x44, 0xcc, 0x44, 0x0f, 0x1e, 0x4d, 0xc8, 0x3b, 0xcd, 0x38,
+  0xcb, 0xe2, 0x1b, 0xe0, 0x9d, 0x83, 0x8e, 0xbd, 0x39, 0x5d, 0xf1, 0xe4, 0x66, 0x4c, 0x1e, 0x0b,
+  0xd0, 0x08, 0x18, 0x69, 0xf4, 0x7a, 0x21, 0xb2, 0x75, 0x1a, 0x8f, 0xc9, 0x83, 0x21, 0xc5, 0xbf,
+  0x09, 0x2c, 0x26, 0xc9, 0xc4, 0x98, 0x5c, 0x2f, 0xb9, 0x62, 0xde, 0x3c, 0xa3, 0x41, 0x5e, 0x88,
+  0x0c, 0x71, 0xc1, 0x94, 0xa7, 0x4c, 0x68, 0xa5, 0xde, 0x9a, 0xa5, 0x8e, 0xc9, 0x70, 0x34, 0xd0,
+  0x54, 0x85, 0x9e, 0x84, 0xae, 0x55, 0x56, 0x70, 0xa1, 0x75, 0x35, 0x4b, 0xcc, 0x65, 0x9e, 0x50,
+  0xd0, 0x63, 0x9e, 0x30, 0x20, 0x7f, 0xb5, 0x96, 0x8a, 0xcf, 0x6f, 0x7a, 0xd6, 0x8c, 0x63, 0x22,
+  0x73, 0x0a, 0xf6, 0x9b, 0x31, 0x75, 0xcd, 0x58, 0x3a, 0x21, 0x34, 0xe1, 0x8b, 0xb4, 0x07, 0xea,
+  0xac, 0xe4, 0x98, 0x44, 0x40, 0xc1, 0x84, 0x9b, 0x03, 0x16, 0xaa, 0x54, 0xb6, 0x72, 0xea, 0xd5,
+  0xb4, 0xad, 0xac, 0x6f, 0x44, 0xf1, 0x6f, 0xe2, 0x2c, 0x24, 0x68, 0xcc, 0xd7, 0x20, 0x6f, 0xe8,
+  0xaf, 0x6b, 0x2d, 0x61, 0x84, 0xa7, 0xf3, 0xac, 0xa9, 0x64, 0xab, 0x12, 0x0b, 0x9a, 0x83, 0x84,
+  0xbd, 0x9a, 0x04, 0x0c, 0x0f, 0x67, 0x71, 0xf0, 0x0b, 0x73, 0xea, 0xe8, 0x07, 0xd7, 0x8c, 0x2f,
+  0x96, 0x0a, 0x1d, 0x95, 0xc4, 0x85, 0xb1, 0x1f, 0xec, 0x9e, 0x3c, 0x3e, 0xdb, 0x1b, 0x14, 0x52,
+  0x44, 0x96, 0xc0, 0xfa, 0x69, 0xbc, 0x40, 0x39, 0xc5, 0xa2, 0xf6, 0xf3, 0xb7, 0x64, 0xb8, 0xaf,
+  0x17, 0x56, 0x5b, 0xc3, 0x5e, 0x21, 0xde, 0xcc, 0x37, 0xdc, 0xd9, 0x30, 0x5f, 0x43, 0x7e, 0x48,
+  0xe3, 0x15, 0x4f, 0x61, 0x96, 0x8a, 0xad, 0xe6, 0xf3, 0xbd, 0x5f, 0x8c, 0x46, 0x6d, 0xe4, 0xab,
+  0x0c, 0x26, 0xa6, 0x2a, 0x13, 0x4d, 0x96, 0x47, 0x07, 0x83, 0xb6, 0x15, 0x84, 0x98, 0x27, 0xac,
+  0x41, 0x3f, 0x1a, 0x3e, 0xda, 0x3f, 0xdb, 0x69, 0xa3, 0x5f, 0xac, 0x99, 0x54, 0x75, 0xf2, 0x47,
+  0x0c, 0xff, 0x0a, 0xf2, 0x24, 0x5b, 0x64, 0x6b, 0xd5, 0x9b, 0xa9, 0xd4, 0x37, 0x10, 0xfa, 0xb2,
+  0xcd, 0xf5, 0xf3, 0xdd, 0xdd, 0x9d, 0x9d, 0xfd, 0x7a, 0x68, 0x1b, 0x23, 0x8e, 0x49, 0x9a, 0xa5,
+  0xac, 0x61, 0x52, 0x6d, 0xd1, 0x68, 0x2d, 0x24, 0x32, 0xe4, 0x19, 0x37, 0xfe, 0xb6, 0xb3, 0x2f,
+  0x04, 0x8f, 0xfd, 0x08, 0xc1, 0xfb, 0x89, 0xfe, 0xdf, 0x83, 0xf8, 0x80, 0x67, 0x8a, 0x41, 0x30,
+  0x27, 0xeb, 0x55, 0x0a, 0x92, 0x04, 0xcb, 0x19, 0x55, 0x01, 0x66, 0x42, 0x6f, 0xce, 0xd5, 0x36,
+  0x01, 0x7b, 0x43, 0xce, 0x04, 0x3b, 0x98, 0x2b, 0xdb, 0x64, 0x38, 0x17, 0xdd, 0xae, 0x8d, 0xa4,
+  0x91, 0x97, 0x3d, 0xb5, 0xc8, 0x76, 0x89, 0x07, 0x05, 0xa2, 0x61, 0xc9, 0xdb, 0x02, 0x7b, 0x43,
+  0xfe, 0xa2, 0x98, 0xe5, 0xa8, 0x28, 0x29, 0xc5, 0x64, 0xcd, 0x48, 0x3a, 0xd0, 0x86, 0x68, 0x0d,
+  0xd3, 0x07, 0x09, 0x8b, 0xcf, 0x05, 0x43, 0xff, 0x82, 0xa4, 0xb2, 0x06, 0x20, 0xc7, 0xd2, 0x86,
+  0xdd, 0x70, 0x54, 0xa9, 0x08, 0x78, 0x67, 0x8b, 0x42, 0xdd, 0xe0, 0x83, 0x9f, 0x95, 0x2e, 0xd9,
+  0x05, 0x2a, 0x99, 0x25, 0x60, 0xe5, 0x07, 0xfb, 0xfb, 0xe0, 0x38, 0x25, 0x68, 0x2a, 0xa1, 0x8c,
+  0x66, 0x20, 0x82, 0x26, 0x09, 0x19, 0x84, 0x3b, 0xb2, 0xe6, 0xe3, 0x9d, 0x9d, 0x32, 0x98, 0x40,
+  0x2f, 0x97, 0xc5, 0x8a, 0xbd, 0x55, 0x3d, 0x9d, 0xbb, 0x8d, 0xd2, 0xa1, 0xb2, 0xbc, 0x6d, 0xc1,
+  0xbb, 0xfe, 0x82, 0x29, 0xa5, 0x4d, 0xa9, 0x31, 0xbf, 0xf2, 0x8a, 0x31, 0x08, 0x20, 0x65, 0xdc,
+  0xcf, 0xd6, 0x60, 0xc8, 0x6a, 0x50, 0x8e, 0x30, 0x28, 0xf7, 0x7c, 0x2b, 0x34, 0xe6, 0xdc, 0x6f,
+  0x8d, 0xb6, 0xb6, 0x90, 0xac, 0x06, 0xad, 0x6f, 0x17, 0x7d, 0x3d, 0xcf, 0xc4, 0x0a, 0xac, 0x33,
+  0x94, 0xb5, 0xec, 0xdf, 0x1b, 0xd4, 0x55, 0x1c, 0xd3, 0x48, 0xf1, 0x2b, 0xac, 0x2f, 0x05, 0x23,
+  0x14, 0x5e, 0xec, 0x51, 0xc1, 0x20, 0x7c, 0xb4, 0xd7, 0xad, 0x93, 0x43, 0xb0, 0xd3, 0x19, 0x98,
+  0x00, 0x18, 0x32, 0x28, 0xcf, 0x5c, 0x41, 0xdc, 0x0f, 0xc2, 0xdd, 0x52, 0xed, 0x34, 0x43, 0x43,
+  0x27, 0xd9, 0x35, 0x2b, 0xeb, 0x4c, 0x56, 0xad, 0x2c, 0xbd, 0x7a, 0x1c, 0x55, 0x13, 0xd2, 0x31,
+  0xcd, 0xe7, 0xed, 0x5c, 0xed, 0x69, 0x5c, 0xb4, 0xa4, 0xa4, 0x56, 0x94, 0x0a, 0x3e, 0x57, 0x6a,
+  0x36, 0xf0, 0xa5, 0x0a, 0x8a, 0x8f, 0xec, 0xdd, 0x4b, 0x52, 0x0f, 0x77, 0x1b, 0x49, 0xed, 0x37,
+  0x98, 0x07, 0x52, 0x51, 0xb5, 0x96, 0x65, 0xde, 0xdd, 0x16, 0x83, 0x95, 0x08, 0x6a, 0x8b, 0xf6,
+  0xb6, 0xf8, 0x68, 0x8b, 0x77, 0xbb, 0x52, 0x1a, 0x45, 0x4c, 0xca, 0x5e, 0xcc, 0x52, 0xae, 0xdd,
+  0x58, 0x98, 0xd5, 0x56, 0x6e, 0xa3, 0x00, 0x22, 0x8e, 0x31, 0xe1, 0x0a, 0x64, 0x44, 0xed, 0xe2,
+  0x6e, 0x69, 0xb2, 0x62, 0x31, 0xa3, 0xc1, 0x68, 0x6f, 0x6f, 0x7b, 0xb8, 0x37, 0xda, 0x1e, 0x6c,
+  0x43, 0x20, 0x76, 0xdb, 0xd5, 0xb4, 0x2a, 0xe5, 0x4c, 0xac, 0xb8, 0x94, 0x10, 0xbf, 0xb2, 0x97,
+  0x70, 0x5d, 0xf5, 0xf1, 0xc7, 0x69, 0x61, 0x82, 0xdc, 0x87, 0x3a, 0x9b, 0xf8, 0x12, 0xee, 0xa7,
+  0xdc, 0x81, 0x49, 0xc9, 0x02, 0x0b, 0xd9, 0xda, 0x56, 0x16, 0x15, 0x6d, 0xbe, 0xbb, 0x37, 0xf8,
+  0xc1, 0x6d, 0x2a, 0x27, 0x7c, 0x9c, 0x50, 0xd0, 0x39, 0x5a, 0xf2, 0x44, 0xd7, 0xe6, 0xea, 0xac,
+  0x66, 0x0d, 0xd6, 0xfd, 0x3a, 0xe7, 0x20, 0x75, 0x9e, 0x66, 0x0b, 0x8b, 0x9c, 0x5c, 0x9d, 0xdc,
+  0x31, 0xc8, 0x29, 0xbb, 0x62, 0x62, 0x0e, 0x39, 0xd4, 0x03, 0xb5, 0x4c, 0x99, 0x6c, 0x74, 0xf5,
+  0xb2, 0x03, 0xf6, 0x40, 0x49, 0x71, 0x53, 0x5b, 0xf8, 0xa4, 0x5e, 0x98, 0x5a, 0x41, 0xde, 0xe6,
+  0xd2, 0xd2, 0x4b, 0xd8, 0x1c, 0xf5, 0x29, 0x8d, 0x55, 0xc3, 0x26, 0x38, 0xb1, 0xe2, 0x1a, 0xe1,
+  0xb8, 0x08, 0x3a, 0x38, 0x38, 0xa8, 0x2a, 0x3a, 0xac, 0x29, 0x8a, 0xa8, 0xc8, 0xa3, 0x77, 0x12,
+  0x37, 0x03, 0x94, 0x25, 0x8f, 0x21, 0x4e, 0xfd, 0x74, 0x2c, 0xed, 0x38, 0xed, 0x5b, 0x58, 0x3c,
+  0xed, 0x1b, 0xbc, 0x3e, 0x45, 0x88, 0xab, 0xf1, 0x32, 0x56, 0xe6, 0x08, 0xbc, 0x21, 0x0f, 0xb7,
+  0x0a, 0x88, 0xba, 0x65, 0xf0, 0xb3, 0x3f, 0x66, 0x80, 0xa8, 0x1d, 0xa8, 0x0e, 0x15, 0x08, 0xb0,
+  0x18, 0x45, 0x18, 0x9e, 0xd3, 0xd4, 0x27, 0x40, 0x80, 0xb7, 0x45, 0x78, 0xec, 0xdd, 0x1d, 0x81,
+  0x56, 0x40, 0xb5, 0x81, 0xa9, 0x44, 0x37, 0x86, 0x0d, 0xef, 0x8f, 0xf5, 0x6d, 0x8d, 0x6f, 0xda,
+  0x07, 0x5d, 0x8a, 0x1b, 0xdb, 0x4c, 0xac, 0x90, 0x12, 0xf3, 0x6c, 0x91, 0x2c, 0x8d, 0x20, 0x3f,
+  0x5f, 0xbb, 0x87, 0x41, 0x77, 0xeb, 0xe8, 0xa9, 0xbe, 0x9a, 0xf6, 0x0d, 0x93, 0x5d, 0xb4, 0x11,
+  0xd7, 0x30, 0x00, 0x56, 0xb5, 0xd6, 0xe5, 0x23, 0x30, 0xf0, 0x57, 0xbe, 0x1c, 0x1d, 0xfd, 0xe7,
+  0xef, 0xdf, 0xff, 0x43, 0xef, 0x50, 0x2e, 0x74, 0xed, 0x02, 0xa3, 0x8f, 0x3c, 0x02, 0xe4, 0xc5,
+  0x15, 0x95, 0x50, 0x00, 0x97, 0xe4, 0x2d, 0xa2, 0x2a, 0xdf, 0xf5, 0x50, 0x6f, 0x0e, 0x43, 0x70,
+  0x84, 0xd2, 0x21, 0x74, 0x8c, 0xd9, 0xac, 0x44, 0xfd, 0xec, 0x12, 0x4a, 0x10, 0xae, 0x8e, 0x62,
+  0x88, 0x87, 0x61, 0x68, 0x0d, 0x56, 0x9b, 0xc4, 0x4a, 0xf9, 0xea, 0xb3, 0xe3, 0x9a, 0x0c, 0x78,
+  0xb2, 0x75, 0xd4, 0x6b, 0x67, 0xaa, 0x5a, 0xbb, 0x72, 0xf3, 0x3e, 0x9b, 0xfc, 0xf8, 0x67, 0x72,
+  0x5e, 0x56, 0x82, 0x9a, 0x51, 0xd6, 0x89, 0xe3, 0xad, 0x57, 0x0b, 0xe3, 0x7e, 0xef, 0x29, 0x5a,
+  0x6b, 0x9d, 0xb4, 0xe8, 0xb0, 0xc9, 0x75, 0x5a, 0x1b, 0xa2, 0x33, 0xe0, 0x70, 0xab, 0x8a, 0xde,
+  0xb0, 0x1e, 0x97, 0x5e, 0xd5, 0x6a, 0xfe, 0xf1, 0x9f, 0xda, 0x75, 0x27, 0xb6, 0xc9, 0xf9, 0x7a,
+  0xd6, 0x93, 0xa5, 0x6c, 0x82, 0x26, 0xf9, 0xb6, 0x9c, 0x05, 0x1d, 0xb3, 0x6f, 0x83, 0x6a, 0x64,
+  0xda, 0xbb, 0xac, 0x12, 0x98, 0x05, 0x63, 0xd0, 0xc9, 0xd2, 0x0e, 0x04, 0xe8, 0xf3, 0x67, 0xd5,
+  0xe0, 0xbc, 0x45, 0xd0, 0x7c, 0xbe, 0x49, 0xd2, 0x7c, 0xae, 0x45, 0x9d, 0x9d, 0xdd, 0x55, 0x96,
+  0xae, 0x39, 0x1b, 0xa4, 0x09, 0x16, 0xa3, 0xb4, 0xaf, 0x58, 0x7c, 0x1f, 0xd2, 0x16, 0x02, 0x76,
+  0xab, 0x28, 0xef, 0x33, 0xbc, 0xb8, 0x0f, 0x89, 0xb3, 0x64, 0xcd, 0x50, 0xe0, 0x31, 0xfc, 0xde,
+  0x87, 0x3c, 0x8d, 0x7c, 0x50, 0xe0, 0x6f, 0xf0, 0xe2, 0x3e, 0x24, 0xde, 0x30, 0x44, 0x7c, 0x28,
+  0xf2, 0x6b, 0x7d, 0x75, 0x1f, 0x32, 0xa3, 0x1b, 0xaa, 0xcd, 0x78, 0x02, 0xbf, 0xf7, 0x21, 0x6f,
+  0x45, 0x17, 0xd0, 0x28, 0x29, 0x8a, 0xfc, 0xd2, 0x5c, 0xd6, 0xa5, 0x6e, 0x4c, 0xfd, 0x2a, 0x64,
+  0xaa, 0xe5, 0xc5, 0x13, 0xfd, 0xb4, 0x56, 0xee, 0x8a, 0x82, 0x68, 0x90, 0x1e, 0x06, 0x17, 0x8d,
+  0x6f, 0xee, 0x98, 0xd7, 0x95, 0x19, 0x66, 0xeb, 0x6f, 0xbf, 0x65, 0xe2, 0xe4, 0x27, 0xa5, 0xfb,
+  0x8f, 0x3f, 0x92, 0x63, 0xcd, 0xe6, 0x32, 0x9e, 0x04, 0x8f, 0xf5, 0xfe, 0xfe, 0x79, 0x9a, 0xdc,
+  0x74, 0xef, 0x94, 0xfd, 0x3f, 0x2d, 0xcb, 0xad, 0x92, 0xd5, 0x44, 0xb7, 0x2a, 0x7c, 0x68, 0xbe,
+  0xd7, 0x65, 0x9a, 0x94, 0x77, 0x42, 0x3f, 0x3c, 0xf3, 0x6b, 0x72, 0x67, 0x8c, 0xe5, 0x28, 0x18,
+  0xac, 0xf6, 0x3b, 0x72, 0x0c, 0x37, 0xef, 0x8f, 0x8a, 0xd2, 0x2d, 0xa6, 0x17, 0xd6, 0x1d, 0x83,
+  0x68, 0x5e, 0x83, 0xc5, 0x12, 0x0b, 0x69, 0x28, 0xef, 0xf0, 0x99, 0x1e, 0xf3, 0xf0, 0x98, 0xc6,
+  0xa1, 0x55, 0x28, 0x86, 0x48, 0xcc, 0x03, 0xdd, 0x06, 0x87, 0xfe, 0x0f, 0x51, 0x04, 0xf8, 0xe0,
+  0xc4, 0xef, 0x5f, 0x26, 0x4e, 0x7e, 0xf8, 0x3d, 0x79, 0x6c, 0xa1, 0x28, 0x01, 0xdc, 0xd0, 0x08,
+  0x0c, 0xe4, 0xf4, 0xb0, 0x6a, 0xb5, 0xfd, 0xd6, 0x95, 0xf0, 0xb5, 0x99, 0xca, 0x48, 0xf0, 0x5c,
+  0x99, 0xf1, 0x84, 0x29, 0x12, 0xd1, 0xd4, 0x85, 0xe2, 0x21, 0x99, 0xd3, 0x44, 0xb2, 0x89, 0x3f,
+  0xf6, 0x6b, 0x00, 0x0c, 0x30, 0x81, 0x6c, 0x0e, 0x72, 0x69, 0x22, 0xb7, 0x31, 0x90, 0x82, 0x75,
+  0x80, 0xe5, 0x82, 0xbd, 0x81, 0xb1, 0xc1, 0xc4, 0xd8, 0x60, 0xbe, 0x4e, 0x23, 0xdc, 0x06, 0x93,
+  0x87, 0x01, 0x8f, 0xbb, 0x80, 0x1b, 0x05, 0x53, 0x6b, 0x91, 0x92, 0x38, 0x8b, 0xd6, 0x2b, 0xb0,
+  0x61, 0xb8, 0x60, 0xea, 0x34, 0x61, 0x78, 0x79, 0x7c, 0xf3, 0x45, 0x8c, 0x44, 0x08, 0x26, 0xab,
+  0xbc, 0x5e, 0xd1, 0x88, 0x40, 0x86, 0x35, 0x08, 0x9f, 0x93, 0xe0, 0xe3, 0x72, 0x19, 0x28, 0xfc,
+  0x61, 0xd0, 0x31, 0xe9, 0xdd, 0xe9, 0x86, 0x3c, 0x05, 0x8c, 0xf9, 0xf9, 0xe5, 0x97, 0x4f, 0x41,
+  0x9b, 0x0e, 0xc4, 0xd2, 0xf7, 0x60, 0x59, 0x2c, 0x1a, 0xc4, 0x94, 0x87, 0xce, 0xc4, 0xaa, 0xe2,
+  0xa0, 0x2d, 0xd9, 0xcc, 0xfd, 0xef, 0x3f, 0xfd, 0x8b, 0x74, 0xc8, 0x27, 0x24, 0x9a, 0x58, 0xca,
+  0x39, 0x53, 0xd1, 0x32, 0xe8, 0xf4, 0x41, 0xb1, 0xbe, 0x1e, 0xe8, 0x86, 0x6a, 0xc9, 0xd2, 0x40,
+  0x90, 0xc3, 0xa3, 0x42, 0x3f, 0xa3, 0xa1, 0x08, 0xed, 0xd6, 0xf2, 0xf0, 0xf0, 0x90, 0xec, 0x0e,
+  0x76, 0xba, 0x44, 0x2d, 0x45, 0x76, 0x0d, 0xd6, 0xba, 0x26, 0xa7, 0x42, 0x64, 0x22, 0xe8, 0x54,
+  0xf5, 0xea, 0x4e, 0x2a, 0xfc, 0x1f, 0x8b, 0x30, 0x7b, 0xdd, 0xc2, 0xf4, 0xf9, 0xe5, 0xe5, 0xb9,
+  0x56, 0xca, 0x4d, 0xe0, 0xf1, 0x59, 0x1b, 0x8b, 0x10, 0x03, 0x36, 0x28, 0x06, 0xde, 0x59, 0x2d,
+  0xe3, 0xaa, 0x96, 0x9b, 0x97, 0xfd, 0xd7, 0x1f, 0xf4, 0x0c, 0xb1, 0x27, 0x20, 0xa2, 0xb8, 0x72,
+  0xa6, 0x25, 0xdc, 0xc6, 0xf9, 0x17, 0xcd, 0xc9, 0xc2, 0x15, 0xac, 0x0c, 0x6a, 0x3b, 0x18, 0xd9,
+  0xaa, 0x51, 0xf7, 0x6d, 0x35, 0xf9, 0xeb, 0xee, 0xb5, 0xc1, 0x66, 0x7d, 0xeb, 0xa7, 0xf8, 0x87,
+  0x7a, 0xf8, 0x36, 0x19, 0xe8, 0x67, 0xab, 0x49, 0x02, 0x49, 0x65, 0x75, 0x83, 0xdc, 0xea, 0xd4,
+  0x1d, 0x6f, 0x46, 0xfe, 0x2f, 0x7c, 0x7f, 0xab, 0x41, 0xee, 0x10, 0x01, 0xb7, 0xf3, 0xdf, 0x39,
+  0x0e, 0x04, 0x4b, 0xa1, 0xda, 0x02, 0x26, 0x0e, 0xe2, 0x32, 0x06, 0xb0, 0xac, 0xe4, 0x20, 0x08,
+  0xa6, 0x29, 0xf7, 0x31, 0xa5, 0x95, 0x70, 0x58, 0x16, 0xc3, 0xc5, 0xa6, 0xa4, 0x24, 0x40, 0x23,
+  0xc6, 0xda, 0x46, 0x4c, 0xfb, 0x40, 0xf7, 0x41, 0x6f, 0xf9, 0x79, 0xa8, 0xfb, 0x44, 0x58, 0x96,
+  0xfe, 0x13, 0x7d, 0x5a, 0x05, 0x94, 0x62, 0x31, 0x0b, 0xf4, 0xd2, 0x43, 0x00, 0xa3, 0xf0, 0xdb,
+  0xd9, 0x36, 0x77, 0x1a, 0x4c, 0x7a, 0xf7, 0x08, 0x05, 0xf1, 0xb6, 0xdb, 0x99, 0x34, 0xc5, 0x66,
+  0x6f, 0x2f, 0x96, 0x34, 0x06, 0xe7, 0x81, 0xc0, 0x01, 0x19, 0x10, 0x3c, 0x84, 0x32, 0x67, 0x31,
+  0x3f, 0x45, 0xf4, 0xf6, 0x20, 0x3c, 0xf0, 0xc5, 0x4b, 0xed, 0xdb, 0x13, 0xf3, 0x52, 0x06, 0x45,
+  0x3f, 0x7f, 0x56, 0x19, 0x35, 0x93, 0x47, 0x6e, 0x25, 0x76, 0x57, 0x5f, 0x90, 0xbc, 0x23, 0x0c,
+  0xea, 0xf6, 0xdd, 0xac, 0x80, 0x8d, 0xf0, 0x7d, 0x0b, 0xc3, 0x03, 0x80, 0x5b, 0xb5, 0x3b, 0x3b,
+  0xbb, 0x55, 0x3d, 0x73, 0x7a, 0x58, 0xaa, 0x57, 0xe6, 0xaa, 0xd9, 0x25, 0x42, 0x50, 0xd5, 0x24,
+  0x7e, 0x90, 0x63, 0xea, 0x01, 0xb7, 0xce, 0x63, 0x08, 0x0b, 0x13, 0xb7, 0x41, 0x19, 0x14, 0x2e,
+  0xc3, 0x8b, 0xc2, 0x56, 0x26, 0xb7, 0x08, 0x5f, 0xc9, 0x2c, 0x0d, 0xba, 0xee, 0x99, 0x8b, 0xd8,
+  0x4a, 0x4e, 0x00, 0x66, 0x93, 0x19, 0xac, 0x8f, 0xe9, 0x54, 0x65, 0xdd, 0x0d, 0xe1, 0x0e, 0xed,
+  0xff, 0x14, 0x0f, 0x89, 0x3e, 0x57, 0xab, 0x24, 0x80, 0x9b, 0x52, 0x01, 0x9b, 0xc0, 0xdf, 0x54,
+  0x76, 0xe7, 0xee, 0x4c, 0x09, 0x40, 0x6d, 0xed, 0x31, 0x9e, 0xf8, 0x6c, 0x1d, 0x3d, 0xfc, 0x0e,
+  0xae, 0x43, 0xbc, 0x06, 0xbd, 0x57, 0xf9, 0x3b, 0xd3, 0xf8, 0xf5, 0xce, 0xbb, 0x72, 0xde, 0xe1,
+  0xce, 0x7c, 0x1c, 0x87, 0x3b, 0x26, 0x79, 0x67, 0xf7, 0xe1, 0x63, 0x62, 0x9e, 0x53, 0xad, 0xa5,
+  0x13, 0xa3, 0xff, 0x7f, 0x53, 0x59, 0x48, 0xbf, 0xaf, 0xa1, 0x2b, 0xa1, 0xf2, 0xb5, 0x24, 0x73,
+  0xf0, 0x24, 0xaa, 0xc7, 0x99, 0xc4, 0x32, 0x05, 0x68, 0x50, 0x2d, 0x61, 0x4e, 0xb0, 0x12, 0xc1,
+  0x13, 0x38, 0x40, 0x7a, 0x8c, 0xc8, 0x65, 0x76, 0x9d, 0xb6, 0x79, 0x00, 0x51, 0x46, 0xd0, 0xec,
+  0xea, 0x0e, 0x80, 0x74, 0x5d, 0x11, 0xaf, 0xb7, 0x5e, 0x18, 0xfb, 0x54, 0xf2, 0x34, 0x62, 0x87,
+  0xe8, 0xef, 0x12, 0x7c, 0xdc, 0xe2, 0xb1, 0x5a, 0xf1, 0x8b, 0xf1, 0x08, 0x4c, 0x86, 0xa0, 0xfd,
+  0x29, 0x05, 0x99, 0x34, 0xcf, 0xc1, 0xa3, 0x20, 0xc4, 0xab, 0xa6, 0x15, 0x4c, 0x13, 0x87, 0x78,
+  0x5b, 0x0e, 0xa2, 0xab, 0x15, 0x7a, 0xf2, 0x09, 0xb8, 0x44, 0x57, 0x21, 0x0f, 0x9a, 0x35, 0x6a,
+  0xb9, 0xa1, 0x0b, 0xdf, 0xac, 0x99, 0xb8, 0xb9, 0x60, 0x09, 0x8b, 0x14, 0x96, 0xf2, 0xf2, 0xb8,
+  0xb0, 0xd3, 0xf5, 0x2b, 0x13, 0xb1, 0x72, 0xab, 0xf5, 0x54, 0x3b, 0xdf, 0x42, 0xdb, 0x06, 0x18,
+  0x9d, 0x98, 0x53, 0x3c, 0x7d, 0xe8, 0xe7, 0x80, 0xad, 0xd9, 0x8a, 0x3c, 0xcb, 0x88, 0xd3, 0xcc,
+  0xf8, 0xd2, 0xcb, 0xc7, 0x77, 0xad, 0x95, 0xfd, 0x8e, 0x51, 0x5c, 0x98, 0xac, 0x1a, 0xc2, 0xb8,
+  0x5e, 0x8c, 0x22, 0x09, 0x66, 0x9b, 0xfa, 0xae, 0xa9, 0xf9, 0xb2, 0x62, 0x5d, 0xc7, 0xf0, 0x09,
+  0x19, 0xba, 0xf1, 0x3b, 0x1a, 0xf8, 0xce, 0xe6, 0x6d, 0x33, 0x69, 0x61, 0x8a, 0x62, 0x10, 0x52,
+  0x42, 0x3d, 0x8e, 0x5f, 0x51, 0xb4, 0x2a, 0x52, 0xe1, 0x8e, 0x04, 0x62, 0x04, 0xaa, 0x4b, 0xdc,
+  0xd9, 0x6e, 0x26, 0x6e, 0xa1, 0x06, 0x6c, 0xe2, 0x13, 0xa6, 0x17, 0x8e, 0x72, 0xf4, 0xa9, 0x33,
+  0x94, 0x88, 0x30, 0x61, 0xe9, 0x42, 0x2d, 0xc9, 0x11, 0xd9, 0x1b, 0x14, 0x1a, 0x08, 0xb6, 0xca,
+  0xae, 0xd8, 0x09, 0x92, 0x38, 0xfa, 0x39, 0x17, 0x52, 0xe9, 0x27, 0xdd, 0x7a, 0xa2, 0x5d, 0x42,
+  0x1e, 0x81, 0x52, 0x57, 0x90, 0x57, 0xf9, 0x5a, 0x2e, 0x21, 0xc9, 0xf0, 0xe8, 0x28, 0x82, 0x14,
+  0x5b, 0xc0, 0x35, 0x4d, 0x63, 0x8d, 0x0d, 0x40, 0x8e, 0x4b, 0xc2, 0x09, 0xbe, 0xf3, 0x59, 0x22,
+  0x82, 0xe1, 0x92, 0xe4, 0x00, 0x66, 0x58, 0xec, 0x64, 0x19, 0x25, 0x31, 0x33, 0x63, 0xf7, 0x5d,
+  0x03, 0x91, 0x5c, 0x49, 0xd8, 0x59, 0x80, 0xbb, 0xc9, 0x31, 0x20, 0x0d, 0x98, 0x4a, 0x92, 0x6b,
+  0xae, 0x96, 0xd9, 0x5a, 0x91, 0xd3, 0x2b, 0x90, 0x79, 0x91, 0xad, 0x45, 0xc4, 0xb4, 0xa4, 0xb0,
+  0x1a, 0x00, 0x72, 0x3d, 0xc3, 0x8d, 0xc5, 0x8c, 0xd5, 0x33, 0xf8, 0x9a, 0xa7, 0xd0, 0x1e, 0x42,
+  0x8f, 0xdd, 0x8f, 0x6e, 0xc9, 0xd4, 0x17, 0x18, 0xb2, 0x57, 0x34, 0x09, 0xfc, 0x3a, 0xbc, 0x4d,
+  0x86, 0x83, 0xc1, 0xa0, 0x96, 0x39, 0x95, 0x62, 0xd0, 0xe4, 0xc4, 0xe7, 0xdb, 0xf8, 0x1e, 0x6d,
+  0xd0, 0x40, 0x41, 0xf5, 0x96, 0x62, 0xe2, 0x89, 0x21, 0x64, 0xd0, 0x68, 0xaa, 0x54, 0x0e, 0x0a,
+  0x0a, 0xc3, 0x3b, 0x59, 0x46, 0x15, 0x93, 0x21, 0x24, 0x91, 0xa6, 0x79, 0xca, 0x25, 0xb4, 0x1e,
+  0x26, 0x74, 0x47, 0x82, 0x18, 0xd0, 0x29, 0x52, 0x02, 0x96, 0x5f, 0x5e, 0x3c, 0x7f, 0x16, 0xe6,
+  0xf8, 0x49, 0x4a, 0xc0, 0x42, 0x50, 0x89, 0x76, 0xbb, 0xef, 0x91, 0x02, 0xd1, 0x6b, 0xa5, 0x94,
+  0x19, 0x74, 0x9b, 0x14, 0x70, 0xdc, 0x09, 0x26, 0x27, 0x94, 0x4c, 0x82, 0x69, 0x97, 0xde, 0x18,
+  0xf7, 0xe2, 0x61, 0x25, 0x34, 0xc1, 0xd2, 0xa9, 0x52, 0x09, 0x46, 0x57, 0xe4, 0x9a, 0x4a, 0xd8,
+  0x61, 0xd9, 0x7a, 0xbb, 0x41, 0x89, 0x0c, 0x26, 0x06, 0x2d, 0xc0, 0x71, 0xa0, 0x86, 0x5f, 0x8a,
+  0x37, 0x77, 0x2c, 0x7d, 0xa0, 0xdd, 0xe8, 0x94, 0x66, 0xc0, 0x75, 0x4a, 0x23, 0xcf, 0xba, 0x3f,
+  0xc9, 0xa0, 0xa6, 0x00, 0x73, 0xb8, 0x14, 0x6c, 0x8e, 0xd9, 0xd6, 0xef, 0xb8, 0x32, 0xf3, 0x5e,
+  0xba, 0x7a, 0x16, 0x9c, 0xc3, 0x5e, 0x5c, 0xbf, 0xae, 0x98, 0x61, 0xb8, 0x46, 0xd9, 0x8a, 0x91,
+  0xb9, 0xc8, 0x56, 0xa4, 0x4f, 0x73, 0xde, 0x97, 0x4c, 0x9f, 0xda, 0x12, 0x99, 0x81, 0x19, 0x30,
+  0xe8, 0x01, 0x6b, 0xe2, 0x36, 0x96, 0xcc, 0x6c, 0xea, 0xc4, 0xd0, 0xa9, 0x08, 0x85, 0x47, 0xd1,
+  0x12, 0xae, 0xb1, 0xb9, 0xf3, 0x08, 0x1e, 0x41, 0x38, 0x35, 0x2a, 0x5a, 0x02, 0xf5, 0x43, 0x4b,
+  0x0b, 0x64, 0xb9, 0xd8, 0xca, 0x76, 0x59, 0xea, 0x97, 0x4d, 0xd2, 0xbd, 0xa2, 0x84, 0x18, 0x98,
+  0x94, 0x64, 0xde, 0xce, 0xd9, 0xd1, 0x5d, 0xd9, 0x47, 0x45, 0xc1, 0x2a, 0xb6, 0xd0, 0x32, 0xb4,
+  0xd7, 0x76, 0xbb, 0xac, 0x61, 0x8f, 0x6b, 0xca, 0x0d, 0xe0, 0x23, 0x8b, 0x7e, 0x3d, 0x29, 0xa9,
+  0x8b, 0x57, 0x16, 0x2d, 0xe4, 0x38, 0xb6, 0x81, 0x54, 0x03, 0x82, 0x67, 0xf8, 0x41, 0x0c, 0x82,
+  0xdd, 0xf2, 0xb3, 0x16, 0x6c, 0xa6, 0x86, 0xf1, 0x04, 0x29, 0x0a, 0xbd, 0x4c, 0xee, 0xe8, 0xf5,
+  0x00, 0xc7, 0x8b, 0x22, 0xd3, 0x5e, 0x34, 0x8d, 0xb1, 0x4d, 0x3a, 0xce, 0x56, 0x70, 0xd7, 0x79,
+  0xb9, 0xdd, 0x24, 0x46, 0x8b, 0xb8, 0x94, 0xef, 0xa0, 0xc5, 0xec, 0x4b, 0x8c, 0x8d, 0xc4, 0x26,
+  0xcb, 0x0d, 0x29, 0x5e, 0xb7, 0x12, 0x9a, 0x92, 0x78, 0xc1, 0x94, 0x82, 0xe4, 0x40, 0x72, 0x77,
+  0xd9, 0x4a, 0x6d, 0xce, 0x10, 0x1f, 0x9f, 0x7f, 0x01, 0x84, 0xf0, 0xdf, 0x6e, 0x1e, 0x3b, 0x2f,
+  0x2d, 0xe5, 0x4b, 0xcf, 0x70, 0xde, 0x7b, 0x81, 0xda, 0x16, 0xc7, 0x88, 0x5a, 0xd1, 0x3c, 0xc8,
+  0x31, 0x9e, 0x3b, 0xd3, 0x84, 0x1f, 0xa1, 0x09, 0x83, 0xfc, 0xc5, 0xe0, 0x25, 0xf9, 0x14, 0xb7,
+  0x40, 0xbf, 0xed, 0x90, 0x31, 0xfc, 0xfe, 0xed, 0x0f, 0xb0, 0xf5, 0x00, 0x3c, 0xaa, 0x2d, 0x9c,
+  0xbf, 0x18, 0xbe, 0xc4, 0x9b, 0x69, 0x1f, 0xe9, 0xbb, 0xe1, 0xab, 0x8c, 0xa7, 0x41, 0x07, 0x83,
+  0xfe, 0xa3, 0x4a, 0xe1, 0x2b, 0xcf, 0x36, 0xfc, 0x2d, 0x9b, 0x77, 0xf6, 0xef, 0x3c, 0x89, 0x79,
+  0x6d, 0xdb, 0x4a, 0xd0, 0x31, 0xe7, 0x4c, 0x65, 0x29, 0x6b, 0x20, 0x7e, 0x23, 0xc3, 0x6d, 0x3a,
+  0xeb, 0xf0, 0x5a, 0x6f, 0xa5, 0x75, 0x8b, 0xb1, 0x5e, 0x14, 0xec, 0xcd, 0x9a, 0x0b, 0xa8, 0x9b,
+  0x26, 0x6c, 0x01, 0xed, 0x7d, 0x59, 0x7c, 0x6d, 0x94, 0x0b, 0x68, 0xc8, 0x09, 0x83, 0x4e, 0x14,
+  0x92, 0x93, 0xb5, 0x10, 0x28, 0x03, 0xa3, 0x67, 0xec, 0x45, 0xd2, 0x64, 0xd3, 0xc4, 0x77, 0x50,
+  0xdd, 0xb3, 0x47, 0x71, 0x18, 0x50, 0xec, 0x3a, 0xf1, 0x04, 0xed, 0x4e, 0x62, 0x1a, 0x7d, 0xe4,
+  0xa1, 0xae, 0xc2, 0x77, 0xe4, 0x77, 0xa5, 0xd0, 0x16, 0x3c, 0xaf, 0xe0, 0x74, 0xda, 0x36, 0xff,
+  0x2d, 0x5b, 0xff, 0x61, 0x57, 0x7f, 0x88, 0xb3, 0xa9, 0xd8, 0x4d, 0x9a, 0x7b, 0xfc, 0x67, 0x99,
+  0xc2, 0x17, 0xcd, 0x20, 0x1c, 0x2a, 0x15, 0xd4, 0x66, 0x3c, 0x1c, 0x28, 0xac, 0x51, 0x6c, 0xf2,
+  0x0d, 0xbc, 0xb5, 0x5a, 0x5a, 0x5d, 0xa4, 0xaf, 0x4b, 0xad, 0x9e, 0x39, 0x7b, 0x54, 0x37, 0x3f,
+  0xd5, 0xa7, 0xa6, 0x0b, 0xb8, 0x67, 0x5e, 0x87, 0xf7, 0x61, 0x19, 0x82, 0x43, 0x30, 0x60, 0xd0,
+  0x29, 0x3e, 0x8f, 0x84, 0x06, 0x41, 0x63, 0xa8, 0xad, 0xb8, 0x19, 0xc0, 0x32, 0xd5, 0x29, 0xd5,
+  0x7a, 0x1f, 0xb0, 0x84, 0xcd, 0x87, 0x3d, 0x9d, 0x9c, 0xf6, 0xcd, 0x2b, 0xe3, 0x69, 0xdf, 0x7c,
+  0xf8, 0xf9, 0x5f, 0x36, 0x1a, 0xd8, 0x6b, 0x10, 0x2a, 0x00, 0x00,
+};
+
+#endif // WEBASSETS_H
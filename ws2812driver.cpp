@@ -0,0 +1,132 @@
+#include "ws2812driver.h"
+#include "ws2812encode.h"
+#include <driver/rmt.h>
+#include <esp_timer.h>
+
+// One driver instance per firmware, on a fixed channel
+static const rmt_channel_t WS2812_RMT_CHANNEL = RMT_CHANNEL_0;
+static const uint32_t RMT_CLK_DIV = 2;                         // 80 MHz APB / 2 = 25 ns ticks
+static const uint32_t RMT_TICK_HZ = 80000000 / RMT_CLK_DIV;
+static const uint32_t WS2812_RESET_US = 300;
+static const uint32_t WS2812_US_PER_PIXEL = 30;                // 24 bits * 1.25 us
+
+static const WS2812Timing timing = ws2812Timing(RMT_TICK_HZ);
+
+static_assert(sizeof(rmt_item32_t) == sizeof(uint32_t), "rmt_item32_t layout changed");
+
+// Called by the RMT driver (from its ISR) to refill the channel memory
+static void IRAM_ATTR ws2812Translate(const void* src, rmt_item32_t* dest, size_t srcSize,
+                                      size_t wantedNum, size_t* translatedSize, size_t* itemNum) {
+  size_t bytes = wantedNum / 8;
+  if (bytes > srcSize) {
+    bytes = srcSize;
+  }
+  ws2812Encode((const uint8_t*)src, bytes, (uint32_t*)dest, timing);
+  *translatedSize = bytes;
+  *itemNum = bytes * 8;
+}
+
+WS2812Driver::WS2812Driver(uint16_t numPixels, int16_t pin, uint16_t type)
+    : numPixels_(numPixels), pin_(pin), brightness_(0), started_(false), busy_(false), frameEndUs_(0) {
+  (void)type;  // always GRB / 800 kHz
+  buffers_ = (uint8_t*)calloc((size_t)numPixels_ * 3, 2);
+  front_ = buffers_;
+  back_ = buffers_ ? buffers_ + (size_t)numPixels_ * 3 : nullptr;
+}
+
+WS2812Driver::~WS2812Driver() {
+  if (started_) {
+    waitForFrame();
+    rmt_driver_uninstall(WS2812_RMT_CHANNEL);
+  }
+  free(buffers_);
+}
+
+bool WS2812Driver::begin() {
+  if (started_ || buffers_ == nullptr) {
+    return started_;
+  }
+  rmt_config_t config = RMT_DEFAULT_CONFIG_TX((gpio_num_t)pin_, WS2812_RMT_CHANNEL);
+  config.clk_div = RMT_CLK_DIV;
+  config.mem_block_num = 2;  // double-sized channel RAM: fewer refill interrupts
+
+  if (rmt_config(&config) != ESP_OK ||
+      rmt_driver_install(WS2812_RMT_CHANNEL, 0, 0) != ESP_OK ||
+      rmt_translator_init(WS2812_RMT_CHANNEL, ws2812Translate) != ESP_OK) {
+    log_e("WS2812 RMT init failed on GPIO %d", pin_);
+    return false;
+  }
+  started_ = true;
+  return true;
+}
+
+// Blocks only if the previous frame is still on the wire, then keeps the
+// line low for the latch time
+void WS2812Driver::waitForFrame() {
+  if (!busy_) {
+    return;
+  }
+  rmt_wait_tx_done(WS2812_RMT_CHANNEL, portMAX_DELAY);
+  busy_ = false;
+  int32_t wait = (int32_t)(frameEndUs_ + WS2812_RESET_US - (uint32_t)esp_timer_get_time());
+  if (wait > 0) {
+    delayMicroseconds(wait);
+  }
+}
+
+bool WS2812Driver::canShow() {
+  if (!busy_) {
+    return true;
+  }
+  return (int32_t)((uint32_t)esp_timer_get_time() - (frameEndUs_ + WS2812_RESET_US)) >= 0 &&
+         rmt_wait_tx_done(WS2812_RMT_CHANNEL, 0) == ESP_OK;
+}
+
+void WS2812Driver::show() {
+  if (!started_) {
+    return;
+  }
+  waitForFrame();
+
+  // Swap: the finished back buffer goes on the wire, and the new back
+  // buffer starts as a copy so partial (dirty-range) updates stay correct
+  uint8_t* tmp = front_;
+  front_ = back_;
+  back_ = tmp;
+  memcpy(back_, front_, (size_t)numPixels_ * 3);
+
+  rmt_write_sample(WS2812_RMT_CHANNEL, front_, (size_t)numPixels_ * 3, false);
+  busy_ = true;
+  frameEndUs_ = (uint32_t)esp_timer_get_time() + (uint32_t)numPixels_ * WS2812_US_PER_PIXEL;
+}
+
+void WS2812Driver::setPixelColor(uint16_t index, uint8_t r, uint8_t g, uint8_t b) {
+  if (index >= numPixels_ || back_ == nullptr) {
+    return;
+  }
+  if (brightness_) {
+    r = (r * brightness_) >> 8;
+    g = (g * brightness_) >> 8;
+    b = (b * brightness_) >> 8;
+  }
+  uint8_t* p = back_ + (size_t)index * 3;
+  p[0] = g;
+  p[1] = r;
+  p[2] = b;
+}
+
+void WS2812Driver::setPixelColor(uint16_t index, uint32_t color) {
+  setPixelColor(index, (uint8_t)(color >> 16), (uint8_t)(color >> 8), (uint8_t)color);
+}
+
+void WS2812Driver::clear() {
+  if (back_ != nullptr) {
+    memset(back_, 0, (size_t)numPixels_ * 3);
+  }
+}
+
+// Same convention as Adafruit_NeoPixel: stored +1 so 255 means "no scaling".
+// Only affects pixels written afterwards.
+void WS2812Driver::setBrightness(uint8_t brightness) {
+  brightness_ = brightness + 1;
+}
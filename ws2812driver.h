@@ -0,0 +1,47 @@
+#ifndef WS2812DRIVER_H
+#define WS2812DRIVER_H
+
+#include <Arduino.h>
+
+// WS2812 output through the RMT peripheral. Drop-in for the parts of
+// Adafruit_NeoPixel this firmware uses, but show() does not bit-bang with
+// interrupts disabled: it hands the front buffer to the RMT driver, whose
+// translator encodes it on the fly (ws2812encode.h), and returns while the
+// frame is still being clocked out. Writes go to the back buffer.
+class WS2812Driver {
+ public:
+  WS2812Driver(uint16_t numPixels, int16_t pin, uint16_t type = 0);
+  ~WS2812Driver();
+
+  bool begin();
+  void show();
+  bool canShow();
+
+  void setPixelColor(uint16_t index, uint8_t r, uint8_t g, uint8_t b);
+  void setPixelColor(uint16_t index, uint32_t color);
+  void clear();
+  void setBrightness(uint8_t brightness);
+  uint8_t getBrightness() const { return brightness_; }
+
+  uint8_t* getPixels() const { return back_; }  // GRB, 3 bytes per pixel
+  uint16_t numPixels() const { return numPixels_; }
+
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+  }
+
+ private:
+  void waitForFrame();
+
+  uint16_t numPixels_;
+  int16_t pin_;
+  uint8_t brightness_;  // 0 = full scale, as in Adafruit_NeoPixel
+  uint8_t* buffers_;
+  uint8_t* front_;
+  uint8_t* back_;
+  bool started_;
+  bool busy_;
+  uint32_t frameEndUs_;
+};
+
+#endif // WS2812DRIVER_H
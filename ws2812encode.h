@@ -0,0 +1,68 @@
+#ifndef WS2812ENCODE_H
+#define WS2812ENCODE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// WS2812 bit encoding, independent of the hardware so it can be checked and
+// benchmarked on a host. Each data bit becomes one 32-bit RMT symbol with
+// the same layout as the IDF rmt_item32_t:
+//   bits 0-14 duration0, bit 15 level0, bits 16-30 duration1, bit 31 level1
+
+struct WS2812Timing {
+  uint32_t zero;  // symbol for a 0 bit (short high, long low)
+  uint32_t one;   // symbol for a 1 bit (long high, short low)
+};
+
+constexpr uint32_t rmtSymbol(uint32_t highTicks, uint32_t lowTicks) {
+  return (highTicks & 0x7FFF) | (1u << 15) | ((lowTicks & 0x7FFF) << 16);
+}
+
+// Datasheet timings for 800 kHz parts: T0H 0.4 us, T0L 0.85 us,
+// T1H 0.8 us, T1L 0.45 us. tickHz is the RMT channel clock after clk_div.
+constexpr WS2812Timing ws2812Timing(uint32_t tickHz) {
+  return WS2812Timing{
+    rmtSymbol((uint32_t)((uint64_t)tickHz * 400 / 1000000000ull), (uint32_t)((uint64_t)tickHz * 850 / 1000000000ull)),
+    rmtSymbol((uint32_t)((uint64_t)tickHz * 800 / 1000000000ull), (uint32_t)((uint64_t)tickHz * 450 / 1000000000ull)),
+  };
+}
+
+// Encodes `length` bytes (already in wire order, MSB first) into
+// length * 8 symbols. No branches on the data, so it is cheap enough to
+// run inside the RMT translator ISR.
+static inline void ws2812Encode(const uint8_t* src, size_t length, uint32_t* dst, const WS2812Timing& t) {
+  const uint32_t zero = t.zero;
+  const uint32_t diff = t.one ^ t.zero;
+  for (size_t i = 0; i < length; i++) {
+    uint32_t byte = src[i];
+    dst[0] = zero ^ (diff & (0u - ((byte >> 7) & 1)));
+    dst[1] = zero ^ (diff & (0u - ((byte >> 6) & 1)));
+    dst[2] = zero ^ (diff & (0u - ((byte >> 5) & 1)));
+    dst[3] = zero ^ (diff & (0u - ((byte >> 4) & 1)));
+    dst[4] = zero ^ (diff & (0u - ((byte >> 3) & 1)));
+    dst[5] = zero ^ (diff & (0u - ((byte >> 2) & 1)));
+    dst[6] = zero ^ (diff & (0u - ((byte >> 1) & 1)));
+    dst[7] = zero ^ (diff & (0u - (byte & 1)));
+    dst += 8;
+  }
+}
+
+// Inverse of ws2812Encode(), for checks: returns false on a symbol that is
+// neither a valid 0 nor 1 bit.
+static inline bool ws2812Decode(const uint32_t* src, size_t length, uint8_t* dst, const WS2812Timing& t) {
+  for (size_t i = 0; i < length; i++) {
+    uint8_t byte = 0;
+    for (int bit = 0; bit < 8; bit++) {
+      uint32_t s = src[i * 8 + bit];
+      if (s == t.one) {
+        byte |= (uint8_t)(0x80 >> bit);
+      } else if (s != t.zero) {
+        return false;
+      }
+    }
+    dst[i] = byte;
+  }
+  return true;
+}
+
+#endif // WS2812ENCODE_H